@@ -0,0 +1,316 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#if defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+#include "Common.h"
+
+/// RFC 4648 Base64 and Base32 codecs for byte buffers.
+///
+/// Encoders and decoders work on whole blocks (3 bytes <-> 4 characters for Base64, 5 bytes <-> 8 characters for
+/// Base32) held in a 64-bit register. Decoders look every character up in a table that marks invalid characters
+/// with the high bit and OR the lookups together, so a whole buffer is validated with a single branch at the end.
+/// When SSSE3 is available (e.g. -mssse3 or -march=native), Base64 encodes 12 bytes and decodes 16 characters per
+/// step with pshufb-based lookups
+namespace bits_and_bytes {
+
+    char constexpr BASE_ENCODING_PADDING {'='};
+    inline std::string_view constexpr BASE64_ALPHABET {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+    inline std::string_view constexpr BASE32_ALPHABET {"ABCDEFGHIJKLMNOPQRSTUVWXYZ234567"};
+
+    namespace detail {
+        uint8_t constexpr INVALID_DIGIT {0x80};
+
+        consteval std::array<uint8_t, 256> makeDecodingTable(std::string_view const alphabet) {
+            std::array<uint8_t, 256> table{};
+            table.fill(INVALID_DIGIT);
+            for (size_t i = 0; i < alphabet.size(); ++i) {
+                table[static_cast<unsigned char>(alphabet[i])] = static_cast<uint8_t>(i);
+            }
+            return table;
+        }
+
+        inline std::array<uint8_t, 256> constexpr BASE64_DECODING_TABLE {makeDecodingTable(BASE64_ALPHABET)};
+        inline std::array<uint8_t, 256> constexpr BASE32_DECODING_TABLE {makeDecodingTable(BASE32_ALPHABET)};
+
+        /// Loads up to 8 bytes as a big-endian number, so that the first byte ends up in the most significant bits
+        [[nodiscard]]
+        inline uint64_t loadBigEndian(std::byte const* bytes, size_t const numBytes) {
+            uint64_t value{};
+            for (size_t i = 0; i < numBytes; ++i) {
+                value = value << NUM_BITS_IN_ONE_BYTE | std::to_integer<uint8_t>(bytes[i]);
+            }
+            return value;
+        }
+
+        inline void storeBigEndian(uint64_t const value, std::byte* bytes, size_t const numBytes) {
+            for (size_t i = 0; i < numBytes; ++i) {
+                bytes[i] = static_cast<std::byte>(value >> ((numBytes - 1 - i) * NUM_BITS_IN_ONE_BYTE));
+            }
+        }
+
+        /// Longest encoded input that decoding errors quote in full
+        size_t constexpr MAX_QUOTED_ENCODED_LENGTH {32};
+
+        /// Describes a decoding error without copying large inputs into the message
+        [[nodiscard]]
+        inline BitFormatException makeDecodingError(std::string_view const encoded, std::string_view const encoding,
+                                                    std::string_view const problem) {
+            if (encoded.size() <= MAX_QUOTED_ENCODED_LENGTH) {
+                return BitFormatException(std::format("{} is not a valid {} value: {}.", encoded, encoding, problem));
+            }
+            return BitFormatException(std::format("Input of {} characters is not a valid {} value: {}.",
+                                                  encoded.size(), encoding, problem));
+        }
+
+#if defined(__SSSE3__)
+        /// Encodes 12 bytes into 16 Base64 characters. Reads 16 bytes from input
+        inline void encodeBase64Block(std::byte const* input, char* output) {
+            __m128i in = _mm_loadu_si128(reinterpret_cast<__m128i const*>(input));
+            // Spread each 3-byte group over a 32-bit lane as bytes [b1, b0, b2, b1]
+            in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+            // Move the four 6-bit fields of every lane into separate bytes
+            __m128i const t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+            __m128i const t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+            __m128i const t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+            __m128i const t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+            __m128i const indices = _mm_or_si128(t1, t3);
+            // Map 0-25 -> 'A', 26-51 -> 'a', 52-61 -> '0', 62 -> '+', 63 -> '/' by adding a per-range offset
+            __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            __m128i const isUpperCase = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+            range = _mm_or_si128(range, _mm_and_si128(isUpperCase, _mm_set1_epi8(13)));
+            __m128i const offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                  '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                                  '/' - 63, 'A', 0, 0);
+            __m128i const characters = _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), characters);
+        }
+
+        /// Decodes 16 Base64 characters into 12 bytes. Returns false if any character is not in the alphabet
+        [[nodiscard]]
+        inline bool decodeBase64Block(char const* input, std::byte* output) {
+            __m128i const in = _mm_loadu_si128(reinterpret_cast<__m128i const*>(input));
+            __m128i const highNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+            __m128i const lowNibbles = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+            // Every character class has a bit in both tables; a character is valid only if the bits intersect
+            __m128i const lowClasses = _mm_shuffle_epi8(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                                      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A),
+                                                        lowNibbles);
+            __m128i const highClasses = _mm_shuffle_epi8(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                                       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10),
+                                                         highNibbles);
+            if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lowClasses, highClasses), _mm_setzero_si128()))) {
+                return false;
+            }
+            __m128i const isSlash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+            __m128i const shifts = _mm_shuffle_epi8(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                                                  0, 0, 0, 0, 0, 0, 0, 0),
+                                                    _mm_add_epi8(isSlash, highNibbles));
+            __m128i const values = _mm_add_epi8(in, shifts);
+            // Pack four 6-bit values per lane into 24 bits, then gather the three bytes of every lane
+            __m128i const pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            __m128i const lanes = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+            __m128i const packed = _mm_shuffle_epi8(lanes, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                                                         -1, -1, -1, -1));
+            alignas(16) std::array<std::byte, 16> block;
+            _mm_store_si128(reinterpret_cast<__m128i*>(block.data()), packed);
+            std::memcpy(output, block.data(), 12);
+            return true;
+        }
+#endif
+
+        /// Maps the (numBits / bitsPerDigit) digits in the low bits of value to characters, most significant first
+        inline void encodeDigits(uint64_t const value, size_t const numDigits, uint8_t const bitsPerDigit,
+                                 std::string_view const alphabet, char* output) {
+            uint64_t const digitMask = (uint64_t{1} << bitsPerDigit) - 1U;
+            for (size_t i = 0; i < numDigits; ++i) {
+                output[i] = alphabet[(value >> ((numDigits - 1 - i) * bitsPerDigit)) & digitMask];
+            }
+        }
+
+        /// Accumulates the decoded digits of the characters into value. Invalid characters set INVALID_DIGIT in error
+        inline void decodeDigits(char const* input, size_t const numDigits, uint8_t const bitsPerDigit,
+                                 std::array<uint8_t, 256> const& table, uint64_t& value, uint8_t& error) {
+            for (size_t i = 0; i < numDigits; ++i) {
+                auto const digit = table[static_cast<unsigned char>(input[i])];
+                error |= digit;
+                value = value << bitsPerDigit | (digit & 0x3FU);
+            }
+        }
+
+        /// Generic block codec for encodings whose blocks are bytesPerBlock bytes and charsPerBlock characters
+        template<size_t BytesPerBlock, size_t CharsPerBlock, uint8_t BitsPerDigit>
+        struct BlockCodec {
+            [[nodiscard]]
+            static constexpr size_t getEncodedLength(size_t const numBytes) {
+                return (numBytes + BytesPerBlock - 1) / BytesPerBlock * CharsPerBlock;
+            }
+
+            /// Number of characters needed for a partial block of numBytes bytes, excluding padding
+            [[nodiscard]]
+            static constexpr size_t getPartialBlockLength(size_t const numBytes) {
+                return (numBytes * NUM_BITS_IN_ONE_BYTE + BitsPerDigit - 1) / BitsPerDigit;
+            }
+
+            static void encode(std::span<std::byte const> const input, char* output, std::string_view const alphabet) {
+                size_t i{};
+                for (; i + BytesPerBlock <= input.size(); i += BytesPerBlock, output += CharsPerBlock) {
+                    encodeDigits(loadBigEndian(input.data() + i, BytesPerBlock), CharsPerBlock, BitsPerDigit,
+                                 alphabet, output);
+                }
+                if (auto const remaining = input.size() - i) {
+                    auto const numDigits = getPartialBlockLength(remaining);
+                    auto const value = loadBigEndian(input.data() + i, remaining)
+                        << (numDigits * BitsPerDigit - remaining * NUM_BITS_IN_ONE_BYTE);
+                    encodeDigits(value, numDigits, BitsPerDigit, alphabet, output);
+                    std::memset(output + numDigits, BASE_ENCODING_PADDING, CharsPerBlock - numDigits);
+                }
+            }
+
+            /// Decodes complete blocks, returning the number of decoded bytes
+            /// @exception BitFormatException the input is not a valid encoding
+            static size_t decode(std::string_view const input, std::byte* output, std::string_view const encoding,
+                                 std::array<uint8_t, 256> const& table, size_t start = 0) {
+                if (input.size() % CharsPerBlock) {
+                    throw makeDecodingError(input, encoding, std::format("length {} is not a multiple of {}",
+                                                                         input.size(), CharsPerBlock));
+                }
+                auto const padding = input.size() - 1 - std::min(input.find_last_not_of(BASE_ENCODING_PADDING),
+                                                                  input.size() - 1);
+                auto const numDataChars = input.size() - padding;
+                size_t numBytes = start / CharsPerBlock * BytesPerBlock;
+                // Errors are rare, so the blocks are only searched for the first invalid one once decoding fails
+                auto const invalidBlock = [&](size_t const knownInvalidBlock) {
+                    size_t block = start;
+                    for (; block < knownInvalidBlock; block += CharsPerBlock) {
+                        uint64_t ignored{};
+                        uint8_t blockError{};
+                        decodeDigits(input.data() + block, std::min(CharsPerBlock, numDataChars - block), BitsPerDigit,
+                                     table, ignored, blockError);
+                        if (blockError & INVALID_DIGIT) break;
+                    }
+                    return makeDecodingError(input, encoding, std::format("invalid block at character {}", block));
+                };
+                uint8_t error{};
+                size_t i = start;
+                for (; i + CharsPerBlock <= numDataChars; i += CharsPerBlock, numBytes += BytesPerBlock) {
+                    uint64_t value{};
+                    decodeDigits(input.data() + i, CharsPerBlock, BitsPerDigit, table, value, error);
+                    storeBigEndian(value, output + numBytes, BytesPerBlock);
+                }
+                if (auto const remaining = numDataChars - i) {
+                    auto const partialBytes = remaining * BitsPerDigit / NUM_BITS_IN_ONE_BYTE;
+                    uint64_t value{};
+                    decodeDigits(input.data() + i, remaining, BitsPerDigit, table, value, error);
+                    auto const unusedBits = remaining * BitsPerDigit - partialBytes * NUM_BITS_IN_ONE_BYTE;
+                    // Reject lengths that no byte count produces and non-zero bits after the last byte
+                    if (getPartialBlockLength(partialBytes) != remaining || (value & ((uint64_t{1} << unusedBits) - 1))) {
+                        throw invalidBlock(i);
+                    }
+                    storeBigEndian(value >> unusedBits, output + numBytes, partialBytes);
+                    numBytes += partialBytes;
+                }
+                if (error & INVALID_DIGIT || padding >= CharsPerBlock) {
+                    throw invalidBlock(numDataChars / CharsPerBlock * CharsPerBlock);
+                }
+                return numBytes;
+            }
+        };
+
+        using Base64Codec = BlockCodec<3, 4, 6>;
+        using Base32Codec = BlockCodec<5, 8, 5>;
+    }
+
+    /// Gets the number of characters in the padded Base64 encoding of numBytes bytes
+    [[nodiscard]]
+    constexpr size_t getBase64EncodedLength(size_t const numBytes) {
+        return detail::Base64Codec::getEncodedLength(numBytes);
+    }
+
+    /// Gets the number of characters in the padded Base32 encoding of numBytes bytes
+    [[nodiscard]]
+    constexpr size_t getBase32EncodedLength(size_t const numBytes) {
+        return detail::Base32Codec::getEncodedLength(numBytes);
+    }
+
+    /// Appends the padded Base64 encoding of the bytes to the output string
+    template<typename Allocator>
+    void encodeBase64(std::span<std::byte const> input,
+                      std::basic_string<char, std::char_traits<char>, Allocator>& output) {
+        auto const offset = output.size();
+        output.resize(offset + getBase64EncodedLength(input.size()));
+        char* out = output.data() + offset;
+#if defined(__SSSE3__)
+        size_t constexpr BLOCK_BYTES {12}, BLOCK_CHARS {16};
+        for (; input.size() >= SIXTEEN; input = input.subspan(BLOCK_BYTES), out += BLOCK_CHARS) {
+            detail::encodeBase64Block(input.data(), out);
+        }
+#endif
+        detail::Base64Codec::encode(input, out, BASE64_ALPHABET);
+    }
+
+    /// Gets the padded Base64 encoding of the bytes
+    [[nodiscard]]
+    inline std::string encodeBase64(std::span<std::byte const> const input) {
+        std::string output;
+        encodeBase64(input, output);
+        return output;
+    }
+
+    /// Appends the padded Base32 encoding of the bytes to the output string
+    template<typename Allocator>
+    void encodeBase32(std::span<std::byte const> const input,
+                      std::basic_string<char, std::char_traits<char>, Allocator>& output) {
+        auto const offset = output.size();
+        output.resize(offset + getBase32EncodedLength(input.size()));
+        detail::Base32Codec::encode(input, output.data() + offset, BASE32_ALPHABET);
+    }
+
+    /// Gets the padded Base32 encoding of the bytes
+    [[nodiscard]]
+    inline std::string encodeBase32(std::span<std::byte const> const input) {
+        std::string output;
+        encodeBase32(input, output);
+        return output;
+    }
+
+    /// Decodes padded Base64
+    /// @exception BitFormatException the input is not valid padded Base64
+    [[nodiscard]]
+    inline std::vector<std::byte> decodeBase64(std::string_view const encoded) {
+        std::vector<std::byte> decoded(encoded.size() / 4 * 3);
+        size_t start{};
+#if defined(__SSSE3__)
+        // Stop short of the last block so padding is handled by the scalar codec, which also decodes from the first
+        // invalid block onwards to report where the input is invalid
+        size_t constexpr BLOCK_BYTES {12}, BLOCK_CHARS {16};
+        for (; start + BLOCK_CHARS < encoded.size(); start += BLOCK_CHARS) {
+            if (!detail::decodeBase64Block(encoded.data() + start, decoded.data() + start / 4 * 3)) {
+                break;
+            }
+        }
+        static_assert(BLOCK_CHARS / 4 * 3 == BLOCK_BYTES);
+#endif
+        decoded.resize(detail::Base64Codec::decode(encoded, decoded.data(), "Base64",
+                                                   detail::BASE64_DECODING_TABLE, start));
+        return decoded;
+    }
+
+    /// Decodes padded Base32
+    /// @exception BitFormatException the input is not valid padded Base32
+    [[nodiscard]]
+    inline std::vector<std::byte> decodeBase32(std::string_view const encoded) {
+        std::vector<std::byte> decoded(encoded.size() / 8 * 5);
+        decoded.resize(detail::Base32Codec::decode(encoded, decoded.data(), "Base32", detail::BASE32_DECODING_TABLE));
+        return decoded;
+    }
+}
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "Bits.h"
+
+namespace bits_and_bytes {
+
+    /// Counts the set bits in a byte buffer using the Harley-Seal carry-save adder scheme on 64-bit words, which
+    /// reduces the number of popcount instructions to roughly one per 16 words
+    [[nodiscard]]
+    inline uint64_t countSetBits(std::span<std::byte const> const bytes) {
+        auto const carrySaveAdd = [](uint64_t& high, uint64_t& low, uint64_t const a, uint64_t const b, uint64_t const c) {
+            uint64_t const u = a ^ b;
+            high = (a & b) | (u & c);
+            low = u ^ c;
+        };
+        auto const loadWord = [&bytes](size_t const wordIndex) {
+            uint64_t word;
+            std::memcpy(&word, bytes.data() + wordIndex * sizeof(uint64_t), sizeof(uint64_t));
+            return word;
+        };
+
+        size_t constexpr BLOCK_SIZE {16};
+        size_t const numWords = bytes.size() / sizeof(uint64_t);
+        uint64_t total{}, ones{}, twos{}, fours{}, eights{}, sixteens{};
+        uint64_t twosA{}, twosB{}, foursA{}, foursB{}, eightsA{}, eightsB{};
+        size_t i{};
+        for (; i + BLOCK_SIZE <= numWords; i += BLOCK_SIZE) {
+            carrySaveAdd(twosA, ones, ones, loadWord(i + 0), loadWord(i + 1));
+            carrySaveAdd(twosB, ones, ones, loadWord(i + 2), loadWord(i + 3));
+            carrySaveAdd(foursA, twos, twos, twosA, twosB);
+            carrySaveAdd(twosA, ones, ones, loadWord(i + 4), loadWord(i + 5));
+            carrySaveAdd(twosB, ones, ones, loadWord(i + 6), loadWord(i + 7));
+            carrySaveAdd(foursB, twos, twos, twosA, twosB);
+            carrySaveAdd(eightsA, fours, fours, foursA, foursB);
+            carrySaveAdd(twosA, ones, ones, loadWord(i + 8), loadWord(i + 9));
+            carrySaveAdd(twosB, ones, ones, loadWord(i + 10), loadWord(i + 11));
+            carrySaveAdd(foursA, twos, twos, twosA, twosB);
+            carrySaveAdd(twosA, ones, ones, loadWord(i + 12), loadWord(i + 13));
+            carrySaveAdd(twosB, ones, ones, loadWord(i + 14), loadWord(i + 15));
+            carrySaveAdd(foursB, twos, twos, twosA, twosB);
+            carrySaveAdd(eightsB, fours, fours, foursA, foursB);
+            carrySaveAdd(sixteens, eights, eights, eightsA, eightsB);
+            total += std::popcount(sixteens);
+        }
+        total = 16 * total + 8 * std::popcount(eights) + 4 * std::popcount(fours) + 2 * std::popcount(twos) +
+                std::popcount(ones);
+        for (; i < numWords; ++i) {
+            total += std::popcount(loadWord(i));
+        }
+        for (size_t j = numWords * sizeof(uint64_t); j < bytes.size(); ++j) {
+            total += std::popcount(std::to_integer<uint8_t>(bytes[j]));
+        }
+        return total;
+    }
+
+    /// Summary statistics over a sequence of NumericType values: total population count, per-bit-position set
+    /// counts, distributions of leading and trailing zero counts and the Shannon entropy of the underlying bytes.
+    ///
+    /// Inputs larger than PARALLEL_THRESHOLD values are split across hardware threads and the partial statistics
+    /// are merged
+    template<typename NumericType>
+    class BitStatistics final {
+    static_assert(std::is_integral_v<NumericType>);
+    public:
+        static constexpr uint8_t NUM_BITS {sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE};
+        static constexpr size_t PARALLEL_THRESHOLD {1U << 20U};
+
+        BitStatistics() = default;
+
+        /// Computes statistics over the given values
+        explicit BitStatistics(std::span<NumericType const> const values) {
+            auto const numThreads = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()),
+                                                     values.size() / PARALLEL_THRESHOLD);
+            if (numThreads <= 1) {
+                accumulate(values);
+                return;
+            }
+            std::vector<BitStatistics> partials(numThreads);
+            {
+                std::vector<std::jthread> workers;
+                workers.reserve(numThreads);
+                auto const chunkSize = (values.size() + numThreads - 1) / numThreads;
+                for (size_t t = 0; t < numThreads; ++t) {
+                    auto const chunk = values.subspan(t * chunkSize,
+                                                      std::min(chunkSize, values.size() - t * chunkSize));
+                    workers.emplace_back([&partial = partials[t], chunk] { partial.accumulate(chunk); });
+                }
+            }
+            for (auto const& partial : partials) {
+                merge(partial);
+            }
+        }
+
+        /// Combines the statistics of another sequence into this one
+        void merge(BitStatistics const& another) {
+            count += another.count;
+            auto const add = [](auto& to, auto const& from) {
+                std::ranges::transform(to, from, to.begin(), std::plus{});
+            };
+            add(setBitCounts, another.setBitCounts);
+            add(leadingZeroesHistogram, another.leadingZeroesHistogram);
+            add(trailingZeroesHistogram, another.trailingZeroesHistogram);
+            add(byteHistogram, another.byteHistogram);
+        }
+
+        /// Gets the number of values these statistics were computed over
+        [[nodiscard]]
+        uint64_t getCount() const {
+            return count;
+        }
+
+        /// Gets the total number of set bits across all values
+        [[nodiscard]]
+        uint64_t getPopCount() const {
+            uint64_t popCount{};
+            for (auto const bitCount : setBitCounts) {
+                popCount += bitCount;
+            }
+            return popCount;
+        }
+
+        /// Gets the number of values that have the given bit set. Bit position 0 is the LSB
+        [[nodiscard]]
+        uint64_t getSetBitCount(uint8_t const bitPosition) const {
+            return setBitCounts.at(bitPosition);
+        }
+
+        /// Gets the number of values whose std::countl_zero equals the index. Index NUM_BITS counts zero values
+        [[nodiscard]]
+        std::array<uint64_t, NUM_BITS + 1> const& getLeadingZeroesHistogram() const {
+            return leadingZeroesHistogram;
+        }
+
+        /// Gets the number of values whose std::countr_zero equals the index. Index NUM_BITS counts zero values
+        [[nodiscard]]
+        std::array<uint64_t, NUM_BITS + 1> const& getTrailingZeroesHistogram() const {
+            return trailingZeroesHistogram;
+        }
+
+        /// Gets the Shannon entropy of the byte distribution in bits per byte, in the range [0, 8]
+        [[nodiscard]]
+        double getByteEntropy() const {
+            uint64_t const numBytes = count * sizeof(NumericType);
+            double entropy{};
+            for (auto const frequency : byteHistogram) {
+                if (frequency) {
+                    auto const probability = static_cast<double>(frequency) / static_cast<double>(numBytes);
+                    entropy -= probability * std::log2(probability);
+                }
+            }
+            return entropy;
+        }
+
+        /// Gets the bits that are clear in every value. Always zero for an empty sequence
+        [[nodiscard]]
+        Bits<NumericType> getStuckAtZeroBits() const {
+            return makeMask([this](uint64_t const bitCount) { return count && bitCount == 0; });
+        }
+
+        /// Gets the bits that are set in every value. Always zero for an empty sequence
+        [[nodiscard]]
+        Bits<NumericType> getStuckAtOneBits() const {
+            return makeMask([this](uint64_t const bitCount) { return count && bitCount == count; });
+        }
+
+    private:
+        using UnsignedNumericType = std::make_unsigned_t<NumericType>;
+
+        /// @brief Updates the statistics with a chunk of values
+        ///
+        /// Per-bit counts use a positional popcount: each value is widened to 64 bits and bit b of every byte is
+        /// added into byte lane k of accumulator b, so one pass yields counts for bit positions 8k + b. Byte lanes
+        /// saturate after 255 additions, so the accumulators are drained into setBitCounts every 255 values
+        void accumulate(std::span<NumericType const> const values) {
+            uint64_t constexpr LANE_LSBS {0x0101'0101'0101'0101ULL};
+            size_t constexpr MAX_LANE_COUNT {255};
+            count += values.size();
+            for (size_t start = 0; start < values.size(); start += MAX_LANE_COUNT) {
+                auto const chunk = values.subspan(start, std::min(MAX_LANE_COUNT, values.size() - start));
+                std::array<uint64_t, NUM_BITS_IN_ONE_BYTE> laneCounts{};
+                for (auto const value : chunk) {
+                    uint64_t const word = static_cast<UnsignedNumericType>(value);
+                    for (uint8_t bit = 0; bit < NUM_BITS_IN_ONE_BYTE; ++bit) {
+                        laneCounts[bit] += (word >> bit) & LANE_LSBS;
+                    }
+                }
+                for (uint8_t bit = 0; bit < NUM_BITS_IN_ONE_BYTE; ++bit) {
+                    for (uint8_t lane = 0; lane < sizeof(NumericType); ++lane) {
+                        setBitCounts[lane * NUM_BITS_IN_ONE_BYTE + bit] +=
+                            (laneCounts[bit] >> (lane * NUM_BITS_IN_ONE_BYTE)) & 0xFFU;
+                    }
+                }
+            }
+            for (auto const value : values) {
+                auto const unsignedValue = static_cast<UnsignedNumericType>(value);
+                ++leadingZeroesHistogram[std::countl_zero(unsignedValue)];
+                ++trailingZeroesHistogram[std::countr_zero(unsignedValue)];
+            }
+            auto const bytes = std::as_bytes(values);
+            for (auto const byte : bytes) {
+                ++byteHistogram[std::to_integer<uint8_t>(byte)];
+            }
+        }
+
+        template<typename Predicate>
+        [[nodiscard]]
+        Bits<NumericType> makeMask(Predicate&& isMasked) const {
+            UnsignedNumericType mask{};
+            for (uint8_t bit = 0; bit < NUM_BITS; ++bit) {
+                if (isMasked(setBitCounts[bit])) {
+                    mask |= static_cast<UnsignedNumericType>(UnsignedNumericType{1U} << bit);
+                }
+            }
+            return Bits<NumericType>{static_cast<NumericType>(mask)};
+        }
+
+        uint64_t count{};
+        std::array<uint64_t, NUM_BITS> setBitCounts{};
+        std::array<uint64_t, NUM_BITS + 1> leadingZeroesHistogram{};
+        std::array<uint64_t, NUM_BITS + 1> trailingZeroesHistogram{};
+        std::array<uint64_t, 256> byteHistogram{};
+    };
+}
+
+/// Custom formatter to support printing BitStatistics<T> via std::println. Masks are rendered with the current
+/// Bits string format
+template <typename NumericType>
+struct std::formatter<bits_and_bytes::BitStatistics<NumericType>> : std::formatter<std::string_view> {
+    auto format(bits_and_bytes::BitStatistics<NumericType> const& statistics, std::format_context& ctx) const {
+        return std::formatter<std::string_view>::format(
+            std::format("Count: {}\nPopulation count: {}\nStuck at zero: {}\nStuck at one: {}\nByte entropy: {}",
+                statistics.getCount(), statistics.getPopCount(), statistics.getStuckAtZeroBits(),
+                statistics.getStuckAtOneBits(), statistics.getByteEntropy()), ctx);
+    }
+};
@@ -0,0 +1,6 @@
+// Explicit instantiations compiled into the bytes_static library
+#include "Bits.h"
+
+#define BITS_AND_BYTES_DEFINE(NumericType) BITS_AND_BYTES_INSTANTIATE(, NumericType)
+BITS_AND_BYTES_FOR_EACH_INTEGER_TYPE(BITS_AND_BYTES_DEFINE)
+#undef BITS_AND_BYTES_DEFINE
@@ -1,12 +1,14 @@
 // ReSharper disable CppDFAUnreachableFunctionCall
 #pragma once
 
+#include <array>
 #include <format>
+#include <memory_resource>
+#include <optional>
 #include <ostream>
 #include <ranges>
 #include <string>
 #include <algorithm>
-#include <regex>
 #include "Common.h"
 #include "BitsPresenter.h"
 
@@ -34,12 +36,23 @@ namespace bits_and_bytes {
         ///
         /// If Bits<NumericType> is signed and if the MSB of the input bit string is 1, then bit string is assumed
         /// to be in two's complement form and a signed value is generated accordingly
+        /// Accepted forms are binary, hexadecimal with prefix 0x, octal with prefix 0o and the padded Base32 or Base64
+        /// encoding of the value's bytes, most significant byte first, with prefix base32: or base64:
         /// @exception OutOfRangeException bitString exceeds the bit width of this template type
-        /// @exception BitFormatException bitString is not a valid hexadecimal or binary string
+        /// @exception BitFormatException bitString is not a valid binary, hexadecimal, octal, Base32 or Base64 string
         explicit Bits(std::string_view const bitString)
             : value(convertToDecimal(bitString)) {
         }
 
+        /// @brief Constructs a bit sequence from the bit string, allocating the intermediate strings used for
+        /// parsing from the given memory resource.
+        ///
+        /// Parsing a valid bit string does not use the global allocator
+        /// @see Bits(std::string_view)
+        Bits(std::string_view const bitString, std::pmr::memory_resource* const resource)
+            : value(convertToDecimal(bitString, resource)) {
+        }
+
         /// Compares this bits sequence to another bit sequence of potentially different bit width returning true
         /// if the underlying numeric values are equal
         template<typename AnotherNumericType>
@@ -70,6 +83,7 @@ namespace bits_and_bytes {
         /// @see StringFormat
         [[nodiscard]]
         std::string_view getString() const {
+            instrumentation::countPresenterCacheLookup(presenter.has_value());
             if (!presenter) {
                 presenter = std::make_optional<BitsPresenter>(stringFormat, getNumberOfBits());
                 presenter->format(*this);
@@ -77,15 +91,72 @@ namespace bits_and_bytes {
             return presenter->getOutput();
         }
 
+        /// Gets the bit representation as a string using the current string format, allocating the string from the
+        /// given memory resource. Unlike getString(), the result is not cached
+        [[nodiscard]]
+        std::pmr::string getString(std::pmr::memory_resource* const resource) const {
+            std::pmr::string output{resource};
+            BitsPresenter{stringFormat, getNumberOfBits()}.formatTo(output, *this);
+            return output;
+        }
+
     private:
         // NOTE: Private methods do not perform any sanity checks, it's expected that the public API checks the input
         // for validity before passing them to private methods for further processing
 
         NumericType convertToDecimal(std::string_view const bitString) {
-            inputIsHex = bitString.starts_with("0x");
+            if (bitString.starts_with(BASE64_PREFIX) || bitString.starts_with(BASE32_PREFIX)) {
+                return decodeBytes(bitString);
+            }
+            inputFormat = bitString.starts_with(HEX_PREFIX) ? Format::Hexadecimal
+                : bitString.starts_with(OCTAL_PREFIX) ? Format::Octal : Format::Binary;
+            instrumentation::countParse(inputFormat);
             return binaryAsDecimal(zeroExtend<NumericType>(bitString));
         }
 
+        NumericType convertToDecimal(std::string_view const bitString, std::pmr::memory_resource* const resource) {
+            if (bitString.starts_with(BASE64_PREFIX) || bitString.starts_with(BASE32_PREFIX)) {
+                return decodeBytes(bitString);
+            }
+            inputFormat = bitString.starts_with(HEX_PREFIX) ? Format::Hexadecimal
+                : bitString.starts_with(OCTAL_PREFIX) ? Format::Octal : Format::Binary;
+            instrumentation::countParse(inputFormat);
+            return binaryAsDecimal(zeroExtend<NumericType>(bitString, resource));
+        }
+
+        /// @brief Decodes a Base32 or Base64 bit string into the value whose bytes, most significant first, it encodes.
+        ///
+        /// Fewer bytes than the width of NumericType are zero extended
+        /// @exception OutOfRangeException the string encodes more bytes than the width of NumericType
+        /// @exception BitFormatException the string is not valid padded Base32 or Base64
+        static NumericType decodeBytes(std::string_view const bitString) {
+            bool const isBase64 = bitString.starts_with(BASE64_PREFIX);
+            instrumentation::countParse(isBase64 ? Format::Base64 : Format::Base32);
+            auto const encoded = trim(bitString.substr(isBase64 ? BASE64_PREFIX.size() : BASE32_PREFIX.size()));
+            if (encoded.empty()) { // Like "0x", a prefix without digits is not a value
+                throw BitFormatException(std::format("{} is not a valid {} value.", trim(bitString),
+                                                     isBase64 ? "Base64" : "Base32"));
+            }
+            auto const encodedWidth = isBase64
+                ? getBase64EncodedLength(sizeof(NumericType))
+                : getBase32EncodedLength(sizeof(NumericType));
+            if (encoded.size() > encodedWidth) {
+                throw OutOfRangeException(std::format("{} value {} exceeds type's width of {} bytes",
+                    isBase64 ? "Base64" : "Base32", encoded, sizeof(NumericType)));
+            }
+            std::array<std::byte, SIXTEEN> decoded;
+            auto const numBytes = isBase64
+                ? detail::Base64Codec::decode(encoded, decoded.data(), "Base64", detail::BASE64_DECODING_TABLE)
+                : detail::Base32Codec::decode(encoded, decoded.data(), "Base32", detail::BASE32_DECODING_TABLE);
+            if (numBytes > sizeof(NumericType)) {
+                throw OutOfRangeException(std::format("{} value {} exceeds type's width of {} bytes",
+                    isBase64 ? "Base64" : "Base32", encoded, sizeof(NumericType)));
+            }
+            using UnsignedNumericType = std::make_unsigned_t<NumericType>;
+            return static_cast<NumericType>(static_cast<UnsignedNumericType>(
+                detail::loadBigEndian(decoded.data(), numBytes)));
+        }
+
         [[nodiscard]]
         static constexpr uint8_t getNumberOfBits() {
             return sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE;
@@ -161,8 +232,10 @@ namespace bits_and_bytes {
                 }
             );
             rawValue -= (binaryString[0] - '0') * placeValue;
-            if (rawValue >= MinValue && rawValue <= MaxValue) {
-                return static_cast<NumericType>(rawValue);
+            if constexpr (std::is_signed_v<NumericType>) { // Unsigned types never read two's complement
+                if (rawValue >= MinValue && rawValue <= MaxValue) {
+                    return static_cast<NumericType>(rawValue);
+                }
             }
             throw OutOfRangeException
             (
@@ -176,15 +249,17 @@ namespace bits_and_bytes {
             uint64_t rawValue{};
             uint8_t bitPos{};
             for (auto itr = binaryString.crbegin(); itr != binaryString.crend(); ++itr, ++bitPos) {
-                rawValue += (*itr - '0') * (1 << bitPos);
+                rawValue += static_cast<uint64_t>(*itr - '0') << bitPos;
             }
             if (rawValue <= MaxValue) {
                 return static_cast<NumericType>(rawValue);
             }
 
-            std::string errorPrefix = std::format("{} value {}",
-                inputIsHex ? "Hexadecimal" : "Binary",
-                inputIsHex ? convertBinaryToHexString(binaryString) : binaryString);
+            // Octal values wider than the type are rejected by zeroExtend, so only these formats reach here
+            std::string errorPrefix =
+                inputFormat == Format::Hexadecimal
+                ? std::format("Hexadecimal value {}", convertBinaryToHexString(binaryString))
+                : std::format("Binary value {}", binaryString);
             throw OutOfRangeException(
                 std::format("{} (Decimal = {}) exceeds type's maximum {}",
                     errorPrefix, rawValue, MaxValue)
@@ -200,11 +275,9 @@ namespace bits_and_bytes {
         NumericType value;
         mutable std::optional<BitsPresenter> presenter;
         friend class BitsPresenter;
-        inline static std::regex const HEX_REGEX {"0x[0-9A-Fa-f]{1,16}" };
-        inline static std::regex const BIN_REGEX {"[0-1]{1,64}" };
         static constexpr NumericType MaxValue {std::numeric_limits<NumericType>::max()};
         static constexpr NumericType MinValue {std::numeric_limits<NumericType>::min()};
-        bool inputIsHex{};
+        Format inputFormat {Format::Binary};
     };
 
     // Stream overload to print to output stream
@@ -213,8 +286,51 @@ namespace bits_and_bytes {
         os << bits.getString() << std::endl;
         return os;
     }
+
+    /// Wrapper returned by noFlush() to stream Bits<T> without flushing the output stream. Holds a copy of the bits
+    /// so that the wrapper can outlive the Bits<T> it was made from
+    template<typename NumericType>
+    struct NoFlush {
+        Bits<NumericType> bits;
+    };
+
+    /// Wraps bits so that streaming them writes a newline instead of std::endl
+    /// Example: os << noFlush(Bits{value});
+    template<typename NumericType>
+    [[nodiscard]]
+    NoFlush<NumericType> noFlush(Bits<NumericType> const& bits) {
+        return {bits};
+    }
+
+    // Stream overload to print to output stream without flushing it
+    template<typename NumericType>
+    std::ostream& operator << (std::ostream& os, NoFlush<NumericType> const& noFlush) {
+        os << noFlush.bits.getString() << '\n';
+        return os;
+    }
 }
 
+/// Invokes the macro with every standard integer type. Bits<T> for these types and the functions most commonly
+/// instantiated for them are compiled once into the bytes_static library
+#define BITS_AND_BYTES_FOR_EACH_INTEGER_TYPE(MACRO) \
+    MACRO(char) MACRO(signed char) MACRO(unsigned char) MACRO(short) MACRO(unsigned short) MACRO(int) \
+    MACRO(unsigned int) MACRO(long) MACRO(unsigned long) MACRO(long long) MACRO(unsigned long long)
+
+#define BITS_AND_BYTES_INSTANTIATE(EXTERN, NumericType) \
+    EXTERN template class bits_and_bytes::Bits<NumericType>; \
+    EXTERN template void bits_and_bytes::BitsPresenter::formatTo(std::string&, \
+        bits_and_bytes::Bits<NumericType> const&) const; \
+    EXTERN template std::ostream& bits_and_bytes::operator<<(std::ostream&, \
+        bits_and_bytes::Bits<NumericType> const&);
+
+/// Defined by targets linking bytes_static so that including translation units use the compiled instantiations
+/// instead of instantiating them again
+#ifdef BITS_AND_BYTES_EXTERN_TEMPLATES
+#define BITS_AND_BYTES_DECLARE_EXTERN(NumericType) BITS_AND_BYTES_INSTANTIATE(extern, NumericType)
+BITS_AND_BYTES_FOR_EACH_INTEGER_TYPE(BITS_AND_BYTES_DECLARE_EXTERN)
+#undef BITS_AND_BYTES_DECLARE_EXTERN
+#endif
+
 /// Custom formatter to support printing Bits<T> via std::println
 template <typename NumericType>
 struct std::formatter<bits_and_bytes::Bits<NumericType>> : std::formatter<std::string_view> {
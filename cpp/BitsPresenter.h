@@ -1,6 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "BaseEncoding.h"
 #include "Common.h"
 
 namespace bits_and_bytes {
@@ -16,9 +23,68 @@ namespace bits_and_bytes {
 
         template<typename NumericType>
         void format(Bits<NumericType> const& bits) const {
-            formattedOutput = stringFormat.format == Format::Binary
-                ? formatBinary(bits.asBits())
-                : formatHex(bits.asHex());
+            switch (stringFormat.format) {
+                case Format::Binary:
+                    formattedOutput = formatBinary(bits.asBits());
+                    break;
+                case Format::Hexadecimal:
+                    formattedOutput = formatHex(bits.asHex());
+                    break;
+                default:
+                    formattedOutput.clear();
+                    formatTo(formattedOutput, bits); // Counts the render
+                    return;
+            }
+            instrumentation::countRender(stringFormat.format, stringFormat.bitUnit, formattedOutput.size());
+        }
+
+        /// @brief Appends the formatted bits to the output string.
+        ///
+        /// Produces the same text as format(), but writes the digits straight into the output without building
+        /// intermediate strings, so rendering into a reused buffer does not allocate once the buffer has grown.
+        ///
+        /// Octal output is prefixed with 0o and is never grouped since octal digits do not align with nibbles or
+        /// bytes. Base32 and Base64 output is the padded encoding of the value's bytes, most significant byte first,
+        /// prefixed with base32: or base64:
+        template<typename NumericType, typename Allocator>
+        void formatTo(std::basic_string<char, std::char_traits<char>, Allocator>& output,
+                      Bits<NumericType> const& bits) const {
+            using UnsignedNumericType = std::make_unsigned_t<NumericType>;
+            UnsignedNumericType const number = bits.value;
+            if (stringFormat.format == Format::Base32 || stringFormat.format == Format::Base64) {
+                formatBytesTo(output, number);
+                return;
+            }
+            bool const isHex = stringFormat.format == Format::Hexadecimal;
+            bool const isOctal = stringFormat.format == Format::Octal;
+            uint8_t const bitsPerDigit = isHex ? NUM_BITS_IN_ONE_NIBBLE : isOctal ? THREE : 1U;
+            size_t const numDigits = stringFormat.leadingZeroes == LeadingZeroes::Include
+                ? (numBitsInFormattedOutput + bitsPerDigit - 1U) / bitsPerDigit
+                : std::max<size_t>(1U, (std::bit_width(number) + bitsPerDigit - 1U) / bitsPerDigit);
+            auto const [groupingEnabled, groupSize] = isOctal ? std::pair<bool, uint8_t>{} : getGroupSize(isHex);
+            size_t const numDelimiters = groupingEnabled ? (numDigits - 1U) / groupSize : 0U;
+            size_t const prefixLength = isHex || isOctal ? (groupingEnabled ? 3U : 2U) : 0U;
+
+            auto const offset = output.size();
+            auto const length = prefixLength + numDigits + numDelimiters;
+            output.resize(offset + length);
+            instrumentation::countRender(stringFormat.format, stringFormat.bitUnit, length);
+            char* out = output.data() + offset;
+            if (isHex || isOctal) {
+                *out++ = '0';
+                *out++ = isHex ? 'x' : 'o';
+                if (groupingEnabled) *out++ = ' ';
+            }
+            char const* digits = stringFormat.hexFormat == HexFormat::LowerCase
+                ? "0123456789abcdef"
+                : "0123456789ABCDEF";
+            UnsignedNumericType const digitMask = (1U << bitsPerDigit) - 1U;
+            for (size_t i = numDigits; i-- > 0;) {
+                *out++ = digits[(number >> (i * bitsPerDigit)) & digitMask];
+                if (groupingEnabled && i && i % groupSize == 0) {
+                    *out++ = stringFormat.groupDelimiter;
+                }
+            }
         }
 
         [[nodiscard]]
@@ -27,6 +93,22 @@ namespace bits_and_bytes {
         }
 
     private:
+        template<typename UnsignedNumericType, typename Allocator>
+        void formatBytesTo(std::basic_string<char, std::char_traits<char>, Allocator>& output,
+                           UnsignedNumericType const number) const {
+            std::array<std::byte, sizeof(UnsignedNumericType)> bytes;
+            detail::storeBigEndian(number, bytes.data(), bytes.size());
+            auto const offset = output.size();
+            if (stringFormat.format == Format::Base64) {
+                output.append(BASE64_PREFIX);
+                encodeBase64(bytes, output);
+            } else {
+                output.append(BASE32_PREFIX);
+                encodeBase32(bytes, output);
+            }
+            instrumentation::countRender(stringFormat.format, stringFormat.bitUnit, output.size() - offset);
+        }
+
         [[nodiscard]]
         std::string formatBinary(std::string&& binaryString) const {
             if (stringFormat.leadingZeroes == LeadingZeroes::Include) {
@@ -41,11 +123,10 @@ namespace bits_and_bytes {
 
         [[nodiscard]]
         std::string formatHex(std::string&& hexString) const {
-            std::string result(
-                stringFormat.leadingZeroes == LeadingZeroes::Include
-                    ? numBitsInFormattedOutput / NUM_BITS_IN_ONE_NIBBLE
-                    : hexString.size(), '0'
-            );
+            size_t const numDigits = stringFormat.leadingZeroes == LeadingZeroes::Include
+                ? numBitsInFormattedOutput / NUM_BITS_IN_ONE_NIBBLE
+                : hexString.size();
+            std::string result(numDigits, '0');
             std::ranges::transform(hexString, result.begin(), [this](char const c) {
                 if (stringFormat.hexFormat == HexFormat::LowerCase && std::isupper(c)) {
                     return static_cast<char>('a' + c - 'A');
@@ -109,9 +190,7 @@ namespace bits_and_bytes {
         }
 
         static void reverseString(std::string& str) {
-            for (uint8_t i = static_cast<uint8_t>(str.size()) - 1U, j = 0U; i > j; --i, ++j) {
-                std::swap(str[i], str[j]);
-            }
+            std::ranges::reverse(str);
         }
 
         uint8_t numBitsInFormattedOutput;
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cerrno>
+#include <ostream>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unistd.h>
+#include "Bits.h"
+
+namespace bits_and_bytes {
+
+    /// @brief Buffered destination for rendering many values.
+    ///
+    /// Rendered values are appended to an in-memory buffer, each followed by the separator, and the buffer is
+    /// written to the underlying stream or file descriptor in a single call once it reaches its capacity. Unlike
+    /// operator<<(std::ostream&, Bits<T> const&), writing a value never flushes. The sink flushes on destruction
+    class BitsSink final {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY {1U << 16U};
+
+        /// Creates a sink that writes to an output stream
+        explicit BitsSink(std::ostream& outputStream,
+                          std::string_view const separator = "\n",
+                          StringFormat const& stringFormat = BitsBase::stringFormat,
+                          size_t const capacity = DEFAULT_CAPACITY)
+            : outputStream(&outputStream)
+            , separator(separator)
+            , stringFormat(stringFormat)
+            , capacity(capacity) {
+            buffer.reserve(capacity + SIXTYFOUR * TWO);
+        }
+
+        /// Creates a sink that writes to a file descriptor. The sink does not take ownership of the descriptor
+        explicit BitsSink(int const fileDescriptor,
+                          std::string_view const separator = "\n",
+                          StringFormat const& stringFormat = BitsBase::stringFormat,
+                          size_t const capacity = DEFAULT_CAPACITY)
+            : fileDescriptor(fileDescriptor)
+            , separator(separator)
+            , stringFormat(stringFormat)
+            , capacity(capacity) {
+            buffer.reserve(capacity + SIXTYFOUR * TWO);
+        }
+
+        BitsSink(BitsSink const&) = delete;
+        BitsSink& operator=(BitsSink const&) = delete;
+
+        ~BitsSink() {
+            try {
+                flush();
+            } catch (...) { // NOLINT: Destructors must not throw; call flush() explicitly to observe write errors
+            }
+        }
+
+        /// Renders a value into the buffer, writing the buffer out if it is full
+        template<typename NumericType>
+        BitsSink& operator<<(Bits<NumericType> const& bits) {
+            BitsPresenter{stringFormat, sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE}.formatTo(buffer, bits);
+            buffer += separator;
+            if (buffer.size() >= capacity) {
+                flush();
+            }
+            return *this;
+        }
+
+        /// Renders a sequence of values into the buffer, writing the buffer out each time it fills up
+        template<std::ranges::contiguous_range Range>
+        BitsSink& write(Range const& values) {
+            using NumericType = std::ranges::range_value_t<Range>;
+            BitsPresenter const presenter{stringFormat, sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE};
+            for (auto const value : values) {
+                presenter.formatTo(buffer, Bits<NumericType>{value});
+                buffer += separator;
+                if (buffer.size() >= capacity) {
+                    flush();
+                }
+            }
+            return *this;
+        }
+
+        /// Writes the buffered text to the destination
+        /// @exception std::system_error writing to the file descriptor failed
+        void flush() {
+            if (buffer.empty()) return;
+            if (outputStream) {
+                outputStream->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            } else {
+                writeToFileDescriptor();
+            }
+            buffer.clear();
+        }
+
+    private:
+        void writeToFileDescriptor() const {
+            std::string_view remaining {buffer};
+            while (!remaining.empty()) {
+                auto const written = ::write(fileDescriptor, remaining.data(), remaining.size());
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::system_error(errno, std::generic_category(), "Unable to write bits to file descriptor");
+                }
+                remaining.remove_prefix(static_cast<size_t>(written));
+            }
+        }
+
+        std::ostream* outputStream{};
+        int fileDescriptor{-1};
+        std::string separator;
+        StringFormat stringFormat;
+        size_t capacity;
+        std::string buffer;
+    };
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include "Bits.h"
+#include "Transforms.h"
+
+namespace bits_and_bytes {
+
+    /// @brief Lazily renders a contiguous sequence of values according to a string format.
+    ///
+    /// Each element is rendered on dereference into a buffer owned by the view and returned as a string_view. The
+    /// buffer is reused for every element, so memory use does not depend on the number of values. A string_view is
+    /// only valid until the next element is dereferenced. An optional transform is applied to each value as it is
+    /// rendered, without copying the values
+    template<typename NumericType>
+    class BitsView final : public std::ranges::view_interface<BitsView<NumericType>> {
+    static_assert(std::is_integral_v<NumericType>);
+    public:
+        class Iterator {
+        public:
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            Iterator(BitsView const* view, NumericType const* current)
+                : view(view)
+                , current(current) {}
+
+            [[nodiscard]]
+            std::string_view operator*() const {
+                return view->render(*current);
+            }
+
+            Iterator& operator++() {
+                ++current;
+                return *this;
+            }
+
+            void operator++(int) {
+                ++current;
+            }
+
+            [[nodiscard]]
+            bool operator==(Iterator const& another) const {
+                return current == another.current;
+            }
+
+        private:
+            BitsView const* view{};
+            NumericType const* current{};
+        };
+
+        BitsView(std::span<NumericType const> const values, StringFormat const& stringFormat,
+                 Transform const transform = Transform::None)
+            : values(values)
+            , presenter(stringFormat, sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE)
+            , transform(transform) {}
+
+        [[nodiscard]]
+        Iterator begin() const {
+            return {this, values.data()};
+        }
+
+        [[nodiscard]]
+        Iterator end() const {
+            return {this, values.data() + values.size()};
+        }
+
+        [[nodiscard]]
+        size_t size() const {
+            return values.size();
+        }
+
+    private:
+        std::string_view render(NumericType const value) const {
+            buffer.clear();
+            presenter.formatTo(buffer, Bits<NumericType>{applyTransform(transform, value)});
+            return buffer;
+        }
+
+        std::span<NumericType const> values;
+        BitsPresenter presenter;
+        Transform transform;
+        mutable std::string buffer;
+    };
+
+    namespace views {
+        /// Range adaptor closure created by as_bits()
+        struct AsBits {
+            StringFormat stringFormat;
+            Transform transform;
+
+            template<std::ranges::contiguous_range Range>
+            requires std::ranges::sized_range<Range> && std::ranges::borrowed_range<Range>
+            friend auto operator|(Range&& range, AsBits const& asBits) {
+                using NumericType = std::ranges::range_value_t<Range>;
+                return BitsView<NumericType>{
+                    std::span<NumericType const>{std::ranges::data(range), std::ranges::size(range)},
+                    asBits.stringFormat, asBits.transform};
+            }
+        };
+
+        /// Adapts a contiguous range of integral values into a lazily rendered range of string_views.
+        ///
+        /// Usage: for (std::string_view bits : values | views::as_bits(stringFormat, Transform::BitReverse))
+        [[nodiscard]]
+        inline AsBits as_bits(StringFormat const& stringFormat = BitsBase::stringFormat, // NOLINT: Named after std::views
+                              Transform const transform = Transform::None) {
+            return {stringFormat, transform};
+        }
+    }
+
+    /// @brief Renders a sequence of values into chunks of a fixed number of bytes.
+    ///
+    /// Values are rendered one after another, each followed by the separator, and handed out in chunks of exactly
+    /// chunkSize bytes; only the last chunk may be shorter. A value may straddle two chunks. The renderer holds at
+    /// most one chunk plus one rendered value, regardless of the number of values. An optional transform is applied
+    /// to each value as it is rendered
+    template<typename NumericType>
+    class ChunkedBitsRenderer final {
+    static_assert(std::is_integral_v<NumericType>);
+    public:
+        ChunkedBitsRenderer(std::span<NumericType const> const values, StringFormat const& stringFormat,
+                            size_t const chunkSize, char const separator = '\n',
+                            Transform const transform = Transform::None)
+            : values(values)
+            , presenter(stringFormat, sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE)
+            , chunkSize(std::max<size_t>(chunkSize, 1U))
+            , separator(separator)
+            , transform(transform) {
+            buffer.reserve(this->chunkSize + SIXTYFOUR * TWO);
+        }
+
+        /// Gets the next chunk. The chunk is valid until the next call. An empty chunk signals the end of the input
+        [[nodiscard]]
+        std::string_view next() {
+            if (consumed) {
+                auto const remaining = buffer.size() - consumed;
+                std::memmove(buffer.data(), buffer.data() + consumed, remaining);
+                buffer.resize(remaining);
+                consumed = 0;
+            }
+            while (buffer.size() < chunkSize && nextValue != values.size()) {
+                presenter.formatTo(buffer, Bits<NumericType>{applyTransform(transform, values[nextValue++])});
+                buffer.push_back(separator);
+            }
+            consumed = std::min(chunkSize, buffer.size());
+            return {buffer.data(), consumed};
+        }
+
+    private:
+        std::span<NumericType const> values;
+        BitsPresenter presenter;
+        size_t chunkSize;
+        char separator;
+        Transform transform;
+        std::string buffer;
+        size_t consumed{};
+        size_t nextValue{};
+    };
+}
@@ -5,10 +5,12 @@
 #include <cstdint>
 #include <format>
 #include <ios>
+#include <memory_resource>
 #include <ranges>
-#include <regex>
+#include <iterator>
 #include <string>
 #include <string_view>
+#include "Instrumentation.h"
 
 namespace bits_and_bytes {
 
@@ -20,6 +22,9 @@ namespace bits_and_bytes {
     enum class Format : uint8_t {
         Binary,
         Hexadecimal,
+        Octal,
+        Base32,
+        Base64,
     };
 
     enum class HexFormat : uint8_t {
@@ -66,15 +71,23 @@ namespace bits_and_bytes {
     uint8_t constexpr TWO {2};
     uint8_t constexpr EIGHT {8};
     uint8_t constexpr SIXTYFOUR {64};
-    inline std::regex const HEX_REGEX {"[a-fA-F0-9]{1,16}"};
-    inline std::regex const BIN_REGEX {"[0-1]{1,64}"};
+    uint8_t constexpr THREE {3};
+    uint8_t constexpr MAX_OCTAL_DIGITS {22};
+    inline std::string_view constexpr HEX_PREFIX {"0x"};
+    inline std::string_view constexpr OCTAL_PREFIX {"0o"};
+    inline std::string_view constexpr BASE32_PREFIX {"base32:"};
+    inline std::string_view constexpr BASE64_PREFIX {"base64:"};
 
     struct BitFormatException final : std::runtime_error {
-        explicit BitFormatException(std::string const& message) : std::runtime_error(message) {}
+        explicit BitFormatException(std::string const& message) : std::runtime_error(message) {
+            instrumentation::countException();
+        }
     };
 
     struct OutOfRangeException final : std::runtime_error {
-        explicit OutOfRangeException(std::string const& message) : std::runtime_error(message) {}
+        explicit OutOfRangeException(std::string const& message) : std::runtime_error(message) {
+            instrumentation::countException();
+        }
     };
 
     inline std::string_view trim(std::string_view const bitString) {
@@ -85,59 +98,6 @@ namespace bits_and_bytes {
         return start <= end ? bitString.substr(start, end - start + 1) : std::string_view{};
     }
 
-    inline std::string normalize(std::string_view const bitString) {
-        std::string normalized;
-        normalized.reserve(bitString.length());
-        bool prvSpace{};
-        for (char const c : bitString) {
-            if (c == ' ') {
-                if (!prvSpace) normalized.push_back(' ');
-                prvSpace = true;
-            } else {
-                normalized.push_back(c);
-                prvSpace = false;
-            }
-        }
-        return normalized;
-    }
-
-    inline std::string canonicalize(std::string_view bitString, bool const isHex = false) {
-        if (isHex) {
-            if (!bitString.starts_with("0x")) {
-                throw BitFormatException(std::format("{} is not a valid hexadecimal value.", bitString));
-            }
-            bitString.remove_prefix(TWO); // Remove prefix 0x to retain just the bits
-        }
-        std::string bits;
-        bits.reserve(bitString.size());
-        std::ranges::copy_if(bitString, std::back_inserter(bits), [](char const c) { return c != ' '; });
-        return bits;
-    }
-
-    inline std::string validateHex(std::string_view const hexString) {
-        auto const normalized = normalize(trim(hexString));
-        auto const bits = canonicalize(normalized, true);
-        if ( !std::regex_match(bits,HEX_REGEX)) {
-            std::string suffix {bits.length() > SIXTEEN ? " The largest data type supported by this library is 64-bits" : ""};
-            throw BitFormatException(
-                   std::format("{} is not a valid hexadecimal value.{}", normalized, suffix)
-            );
-        }
-        return bits;
-    }
-
-    inline std::string canonicalizeBinaryString(std::string_view const binaryString) {
-        auto const normalized = normalize(trim(binaryString));
-        auto const bits = canonicalize(binaryString);
-        if (!std::regex_match(bits, BIN_REGEX)) {
-            std::string suffix {bits.length() > SIXTYFOUR ? " The largest data type supported by this library is 64-bits" : ""};
-            throw BitFormatException(
-                std::format("{} is not a valid binary value.{}", normalized, suffix)
-            );
-        }
-        return bits;
-    }
-
     inline std::string nibbleAsBits(char const hexDigit) {
         uint8_t decimal{};
         if (auto const digit = static_cast<char>(std::tolower(static_cast<unsigned char>(hexDigit))); digit >= '0' && digit <= '9') {
@@ -172,30 +132,249 @@ namespace bits_and_bytes {
         return rawVal <= 9 ? '0' + rawVal : 'A' + rawVal - TEN;
     }
 
+    namespace detail {
+        // Implementations of the string helpers below, parameterized on the string type so that the same code
+        // serves both the std::string API and the std::pmr::string overloads
+
+        template<typename String>
+        [[nodiscard]] String normalize(std::string_view const bitString,
+                                       typename String::allocator_type const& allocator) {
+            String normalized{allocator};
+            normalized.reserve(bitString.length());
+            bool prvSpace{};
+            for (char const c : bitString) {
+                if (c == ' ') {
+                    if (!prvSpace) normalized.push_back(' ');
+                    prvSpace = true;
+                } else {
+                    normalized.push_back(c);
+                    prvSpace = false;
+                }
+            }
+            return normalized;
+        }
+
+        template<typename String>
+        [[nodiscard]] String canonicalize(std::string_view bitString, bool const isHex,
+                                          typename String::allocator_type const& allocator) {
+            if (isHex) {
+                if (!bitString.starts_with("0x")) {
+                    throw BitFormatException(std::format("{} is not a valid hexadecimal value.", bitString));
+                }
+                bitString.remove_prefix(TWO); // Remove prefix 0x to retain just the bits
+            }
+            String bits{allocator};
+            bits.reserve(bitString.size());
+            std::ranges::copy_if(bitString, std::back_inserter(bits), [](char const c) { return c != ' '; });
+            return bits;
+        }
+
+        // Matches [a-fA-F0-9]{1,16}
+        [[nodiscard]] inline bool isHexDigits(std::string_view const bits) {
+            return !bits.empty() && bits.length() <= SIXTEEN && std::ranges::all_of(bits, [](char const c) {
+                return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+            });
+        }
+
+        // Matches [0-1]{1,64}
+        [[nodiscard]] inline bool isBinaryDigits(std::string_view const bits) {
+            return !bits.empty() && bits.length() <= SIXTYFOUR && std::ranges::all_of(bits, [](char const c) {
+                return c == '0' || c == '1';
+            });
+        }
+
+        [[nodiscard]] inline bool isOctalDigits(std::string_view const digits) {
+            return !digits.empty() && digits.length() <= MAX_OCTAL_DIGITS && std::ranges::all_of(digits, [](char const c) {
+                return c >= '0' && c <= '7';
+            });
+        }
+
+        template<typename String>
+        [[nodiscard]] String validateHex(std::string_view const hexString,
+                                         typename String::allocator_type const& allocator) {
+            auto const normalized = normalize<String>(trim(hexString), allocator);
+            auto bits = canonicalize<String>(normalized, true, allocator);
+            if (!isHexDigits(bits)) {
+                std::string_view suffix {bits.length() > SIXTEEN ? " The largest data type supported by this library is 64-bits" : ""};
+                throw BitFormatException(
+                       std::format("{} is not a valid hexadecimal value.{}", std::string_view{normalized}, suffix)
+                );
+            }
+            return bits;
+        }
+
+        template<typename String>
+        [[nodiscard]] String canonicalizeBinaryString(std::string_view const binaryString,
+                                                      typename String::allocator_type const& allocator) {
+            auto bits = canonicalize<String>(binaryString, false, allocator);
+            if (!isBinaryDigits(bits)) {
+                std::string_view suffix {bits.length() > SIXTYFOUR ? " The largest data type supported by this library is 64-bits" : ""};
+                throw BitFormatException(
+                    std::format("{} is not a valid binary value.{}",
+                        std::string_view{normalize<String>(trim(binaryString), allocator)}, suffix)
+                );
+            }
+            return bits;
+        }
+
+        template<typename String>
+        [[nodiscard]] String convertHexToCanonicalBinaryString(std::string_view const hexString,
+                                                               typename String::allocator_type const& allocator) {
+            auto const canonicalBitString = validateHex<String>(hexString, allocator);
+            String binaryString{allocator};
+            binaryString.reserve(canonicalBitString.length() * NUM_BITS_IN_ONE_NIBBLE);
+            for (auto const hexDigit : canonicalBitString) {
+                binaryString += nibbleAsBits(hexDigit);
+            }
+            return binaryString;
+        }
+
+        template<typename String>
+        [[nodiscard]] String convertOctalToCanonicalBinaryString(std::string_view const octalString,
+                                                                 typename String::allocator_type const& allocator) {
+            auto const normalized = normalize<String>(trim(octalString), allocator);
+            std::string_view digits {normalized};
+            if (digits.starts_with(OCTAL_PREFIX)) {
+                digits.remove_prefix(OCTAL_PREFIX.size());
+            }
+            auto const canonicalDigits = canonicalize<String>(digits, false, allocator);
+            if (!normalized.starts_with(OCTAL_PREFIX) || !isOctalDigits(canonicalDigits)) {
+                std::string_view suffix {canonicalDigits.length() > MAX_OCTAL_DIGITS ? " The largest data type supported by this library is 64-bits" : ""};
+                throw BitFormatException(
+                    std::format("{} is not a valid octal value.{}", std::string_view{normalized}, suffix)
+                );
+            }
+            String binaryString{allocator};
+            binaryString.reserve(canonicalDigits.length() * THREE);
+            for (auto const octalDigit : canonicalDigits) {
+                auto const value = octalDigit - '0';
+                binaryString.push_back(value & 4 ? '1' : '0');
+                binaryString.push_back(value & 2 ? '1' : '0');
+                binaryString.push_back(value & 1 ? '1' : '0');
+            }
+            return binaryString;
+        }
+
+        template<typename NumericType, typename String>
+        [[nodiscard]] String zeroExtend(std::string_view const bitString,
+                                        typename String::allocator_type const& allocator) {
+            size_t constexpr maxBits = sizeof(NumericType) * EIGHT;
+            String binaryString = bitString.starts_with(HEX_PREFIX)
+                ? convertHexToCanonicalBinaryString<String>(bitString, allocator)
+                : bitString.starts_with(OCTAL_PREFIX)
+                ? convertOctalToCanonicalBinaryString<String>(bitString, allocator)
+                : canonicalizeBinaryString<String>(bitString, allocator);
+            if (bitString.starts_with(OCTAL_PREFIX) && binaryString.length() > maxBits) {
+                // Octal digits carry 3 bits, so the most significant digit may contribute zeroes beyond the type's
+                // width. Drop them so that, e.g., 0o377 is the 8-bit pattern 1111 1111
+                auto const excess = binaryString.length() - maxBits;
+                if (binaryString.find_first_not_of('0') < excess) {
+                    throw OutOfRangeException(std::format("Octal value {} exceeds type's width of {} bits",
+                                                          trim(bitString), maxBits));
+                }
+                binaryString.erase(0, excess);
+            }
+            if (binaryString.length() < maxBits) {
+                String zeroExtended(maxBits, '0', allocator);
+                std::ranges::copy(binaryString | std::views::reverse, zeroExtended.rbegin());
+                return zeroExtended;
+            }
+            return binaryString;
+        }
+
+        template<typename String>
+        [[nodiscard]] String convertBinaryToHexString(std::string_view const binaryString,
+                                                      typename String::allocator_type const& allocator) {
+            auto const canonicalBinaryString = canonicalizeBinaryString<String>(binaryString, allocator);
+            if (canonicalBinaryString.length() % NUM_BITS_IN_ONE_NIBBLE) {
+                throw BitFormatException(
+                    std::format("{} is not a valid sequence of nibbles", binaryString));
+            }
+            String hexString{allocator};
+            hexString.reserve(SIXTEEN + TWO);
+            hexString.push_back('0'); hexString.push_back('x');
+            std::string_view const binStr {canonicalBinaryString };
+            for (size_t i = 0; i < binStr.length(); i+=4) {
+                auto const nibble = binStr.substr(i, NUM_BITS_IN_ONE_NIBBLE);
+                hexString.push_back(asHexDigit(nibble));
+            }
+            return hexString;
+        }
+    }
+
+    inline std::string normalize(std::string_view const bitString) {
+        return detail::normalize<std::string>(bitString, {});
+    }
+
+    /// Overload of normalize() that allocates the result from the given memory resource
+    inline std::pmr::string normalize(std::string_view const bitString, std::pmr::memory_resource* const resource) {
+        return detail::normalize<std::pmr::string>(bitString, resource);
+    }
+
+    inline std::string canonicalize(std::string_view const bitString, bool const isHex = false) {
+        return detail::canonicalize<std::string>(bitString, isHex, {});
+    }
+
+    /// Overload of canonicalize() that allocates the result from the given memory resource
+    inline std::pmr::string canonicalize(std::string_view const bitString, bool const isHex,
+                                         std::pmr::memory_resource* const resource) {
+        return detail::canonicalize<std::pmr::string>(bitString, isHex, resource);
+    }
+
+    inline std::string validateHex(std::string_view const hexString) {
+        return detail::validateHex<std::string>(hexString, {});
+    }
+
+    /// Overload of validateHex() that allocates the result from the given memory resource
+    inline std::pmr::string validateHex(std::string_view const hexString, std::pmr::memory_resource* const resource) {
+        return detail::validateHex<std::pmr::string>(hexString, resource);
+    }
+
+    inline std::string canonicalizeBinaryString(std::string_view const binaryString) {
+        return detail::canonicalizeBinaryString<std::string>(binaryString, {});
+    }
+
+    /// Overload of canonicalizeBinaryString() that allocates the result from the given memory resource
+    inline std::pmr::string canonicalizeBinaryString(std::string_view const binaryString,
+                                                     std::pmr::memory_resource* const resource) {
+        return detail::canonicalizeBinaryString<std::pmr::string>(binaryString, resource);
+    }
+
     /// Canonicalizes a hexadecimal string to a binary string
     inline std::string convertHexToCanonicalBinaryString(std::string_view const hexString) {
-        auto const canonicalBitString = validateHex(hexString);
-        std::string binaryString;
-        binaryString.reserve(canonicalBitString.length() * NUM_BITS_IN_ONE_NIBBLE);
-        for (auto const hexDigit : canonicalBitString) {
-            binaryString += nibbleAsBits(hexDigit);
-        }
-        return binaryString;
+        return detail::convertHexToCanonicalBinaryString<std::string>(hexString, {});
+    }
+
+    /// Overload of convertHexToCanonicalBinaryString() that allocates the result from the given memory resource
+    inline std::pmr::string convertHexToCanonicalBinaryString(std::string_view const hexString,
+                                                              std::pmr::memory_resource* const resource) {
+        return detail::convertHexToCanonicalBinaryString<std::pmr::string>(hexString, resource);
+    }
+
+    /// Canonicalizes an octal string with prefix 0o to a binary string of 3 bits per digit
+    /// @exception BitFormatException the input is not a valid octal string
+    inline std::string convertOctalToCanonicalBinaryString(std::string_view const octalString) {
+        return detail::convertOctalToCanonicalBinaryString<std::string>(octalString, {});
+    }
+
+    /// Overload of convertOctalToCanonicalBinaryString() that allocates the result from the given memory resource
+    inline std::pmr::string convertOctalToCanonicalBinaryString(std::string_view const octalString,
+                                                                std::pmr::memory_resource* const resource) {
+        return detail::convertOctalToCanonicalBinaryString<std::pmr::string>(octalString, resource);
     }
 
     /// Appends leading zeroes to the input bit string.
     /// @exception BitFormatException if the input is not a valid hexadecimal or binary string
     template<typename NumericType>
     [[nodiscard]] std::string zeroExtend(std::string_view const bitString) {
-        std::string binaryString = bitString.starts_with("0x")
-            ? convertHexToCanonicalBinaryString(bitString)
-            : canonicalizeBinaryString(bitString);
-        if (size_t constexpr maxBits = sizeof(NumericType) * EIGHT; binaryString.length() < maxBits) {
-            std::string zeroExtended(maxBits, '0');
-            std::ranges::copy(binaryString | std::views::reverse, zeroExtended.rbegin());
-            return zeroExtended;
-        }
-        return binaryString;
+        return detail::zeroExtend<NumericType, std::string>(bitString, {});
+    }
+
+    /// Overload of zeroExtend() that allocates the result from the given memory resource
+    template<typename NumericType>
+    [[nodiscard]] std::pmr::string zeroExtend(std::string_view const bitString,
+                                              std::pmr::memory_resource* const resource) {
+        return detail::zeroExtend<NumericType, std::pmr::string>(bitString, resource);
     }
 
     /// Converts binary string to hexadecimal string
@@ -203,19 +382,13 @@ namespace bits_and_bytes {
     /// @exception BitFormatException binary string is not a series of nibbles
     [[nodiscard]]
     inline std::string convertBinaryToHexString(std::string_view const binaryString) {
-        auto const canonicalBinaryString = canonicalizeBinaryString(binaryString);
-        if (canonicalBinaryString.length() % NUM_BITS_IN_ONE_NIBBLE) {
-            throw BitFormatException(
-                std::format("{} is not a valid sequence of nibbles", binaryString));
-        }
-        std::string hexString;
-        hexString.reserve(SIXTEEN + TWO);
-        hexString.push_back('0'); hexString.push_back('x');
-        std::string_view const binStr {canonicalBinaryString };
-        for (size_t i = 0; i < binStr.length(); i+=4) {
-            auto const nibble = binStr.substr(i, NUM_BITS_IN_ONE_NIBBLE);
-            hexString.push_back(asHexDigit(nibble));
-        }
-        return hexString;
-    }
-}
\ No newline at end of file
+        return detail::convertBinaryToHexString<std::string>(binaryString, {});
+    }
+
+    /// Overload of convertBinaryToHexString() that allocates the result from the given memory resource
+    [[nodiscard]]
+    inline std::pmr::string convertBinaryToHexString(std::string_view const binaryString,
+                                                     std::pmr::memory_resource* const resource) {
+        return detail::convertBinaryToHexString<std::pmr::string>(binaryString, resource);
+    }
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Bits.h"
+
+namespace bits_and_bytes {
+
+    /// @brief Random-access viewer that renders windows of a file's bits.
+    ///
+    /// The file is memory mapped, so only the pages of the file that back a requested window are read. A window
+    /// starts at any bit offset and is made up of lines of bytesPerLine bytes, each byte rendered with the viewer's
+    /// string format and prefixed with the line's offset, e.g. "0x0000000000000010+3: 1010 0101 ...". The +N suffix
+    /// appears when a line starts N bits into a byte.
+    ///
+    /// Lines are rendered a page (linesPerPage lines) at a time and the most recently used pages are kept in an
+    /// LRU cache, so scrolling back over recent windows does not render again. The cost of rendering a window depends
+    /// only on its size and memory use is bounded by the cache capacity, whatever the size of the file
+    class FileViewer final {
+    public:
+        static constexpr size_t DEFAULT_BYTES_PER_LINE {16};
+        static constexpr size_t DEFAULT_LINES_PER_PAGE {64};
+        static constexpr size_t DEFAULT_CACHE_CAPACITY {32};
+
+        /// Maps the file for reading
+        /// @exception std::system_error the file cannot be opened or mapped
+        explicit FileViewer(std::filesystem::path const& path,
+                            StringFormat const& stringFormat = BitsBase::stringFormat,
+                            size_t const bytesPerLine = DEFAULT_BYTES_PER_LINE,
+                            size_t const linesPerPage = DEFAULT_LINES_PER_PAGE,
+                            size_t const cacheCapacity = DEFAULT_CACHE_CAPACITY)
+            : bytePresenter(stringFormat, NUM_BITS_IN_ONE_BYTE)
+            , offsetPresenter(OFFSET_FORMAT, SIXTYFOUR)
+            , bytesPerLine(std::max<size_t>(bytesPerLine, 1U))
+            , linesPerPage(std::max<size_t>(linesPerPage, 1U))
+            , cacheCapacity(std::max<size_t>(cacheCapacity, 1U)) {
+            int const fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fileDescriptor < 0) {
+                throw std::system_error(errno, std::generic_category(), std::format("Unable to open {}", path.string()));
+            }
+            // The mapping does not need the descriptor once it exists, so the descriptor is closed when the
+            // constructor returns rather than held for the life of the viewer
+            struct DescriptorGuard {
+                int fileDescriptor;
+                ~DescriptorGuard() { ::close(fileDescriptor); }
+            } const guard {fileDescriptor};
+            struct stat fileStatus {};
+            if (::fstat(fileDescriptor, &fileStatus) < 0) {
+                throw std::system_error(errno, std::generic_category(), std::format("Unable to stat {}", path.string()));
+            }
+            auto const fileSize = static_cast<size_t>(fileStatus.st_size);
+            if (fileSize) {
+                void* mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                if (mapping == MAP_FAILED) {
+                    throw std::system_error(errno, std::generic_category(), std::format("Unable to map {}", path.string()));
+                }
+                // Windows are requested at arbitrary offsets, so read-ahead would mostly load pages that are never shown
+                ::madvise(mapping, fileSize, MADV_RANDOM);
+                bytes = {static_cast<std::byte const*>(mapping), fileSize};
+            }
+        }
+
+        FileViewer(FileViewer const&) = delete;
+        FileViewer& operator=(FileViewer const&) = delete;
+
+        ~FileViewer() {
+            if (!bytes.empty()) {
+                ::munmap(const_cast<std::byte*>(bytes.data()), bytes.size());
+            }
+        }
+
+        /// Gets the size of the file in bytes
+        [[nodiscard]]
+        size_t getSize() const {
+            return bytes.size();
+        }
+
+        /// Gets the number of rendered pages held in the cache
+        [[nodiscard]]
+        size_t getNumCachedPages() const {
+            return pages.size();
+        }
+
+        /// @brief Renders numLines lines starting at the given bit offset, one line per row separated by newlines.
+        ///
+        /// The window ends early at the end of the file. Bits after the last whole byte of the file are not shown
+        /// @exception OutOfRangeException bitOffset is not within the file
+        [[nodiscard]]
+        std::string renderWindow(uint64_t const bitOffset, size_t const numLines) {
+            if (bitOffset >= getNumBits()) {
+                throw OutOfRangeException(std::format("Bit offset {} is outside the file's {} bits", bitOffset,
+                                                      getNumBits()));
+            }
+            uint64_t const bitsPerLine = bytesPerLine * NUM_BITS_IN_ONE_BYTE;
+            uint64_t const phase = bitOffset % bitsPerLine;
+            uint64_t line = bitOffset / bitsPerLine;
+            // Lines of this phase that hold at least one whole byte; clamping to them keeps line + numLines from
+            // wrapping around
+            uint64_t const numLinesInFile = phase + NUM_BITS_IN_ONE_BYTE > getNumBits()
+                ? 0U
+                : (getNumBits() - NUM_BITS_IN_ONE_BYTE - phase) / bitsPerLine + 1U;
+            uint64_t const endLine = line + std::min<uint64_t>(numLines, numLinesInFile - std::min(line, numLinesInFile));
+            std::string window;
+            while (line < endLine) {
+                auto const pageIndex = line / linesPerPage;
+                uint64_t const pageFirstBit = phase + pageIndex * linesPerPage * bitsPerLine;
+                if (pageFirstBit + NUM_BITS_IN_ONE_BYTE > getNumBits()) break; // Do not render or cache empty pages
+                Page const& page = getPage(pageFirstBit);
+                auto const first = line - pageIndex * linesPerPage;
+                auto const last = std::min<uint64_t>(endLine - pageIndex * linesPerPage, page.lineEnds.size());
+                if (first >= last) break; // End of file
+                auto const begin = first ? page.lineEnds[first - 1] : 0U;
+                window.append(page.text, begin, page.lineEnds[last - 1] - begin);
+                line = pageIndex * linesPerPage + last;
+                if (last < linesPerPage) break; // Page ends at the end of the file
+            }
+            if (!window.empty()) window.pop_back(); // Trailing newline of the last line
+            return window;
+        }
+
+    private:
+        struct Page {
+            uint64_t firstBit;
+            std::string text;
+            /// Offset one past the newline that ends each line
+            std::vector<size_t> lineEnds;
+        };
+
+        static constexpr StringFormat OFFSET_FORMAT {
+            Order::BigEndian, Format::Hexadecimal, HexFormat::UpperCase, BitUnit::None, LeadingZeroes::Include, ' '
+        };
+
+        [[nodiscard]]
+        uint64_t getNumBits() const {
+            return static_cast<uint64_t>(bytes.size()) * NUM_BITS_IN_ONE_BYTE;
+        }
+
+        /// Reads the 8 bits starting at the bit offset. The offset must leave at least 8 bits in the file
+        [[nodiscard]]
+        uint8_t readByte(uint64_t const bitOffset) const {
+            auto const index = bitOffset / NUM_BITS_IN_ONE_BYTE;
+            auto const shift = bitOffset % NUM_BITS_IN_ONE_BYTE;
+            auto const high = std::to_integer<uint8_t>(bytes[index]);
+            if (!shift) return high;
+            auto const low = std::to_integer<uint8_t>(bytes[index + 1]);
+            return static_cast<uint8_t>(high << shift | low >> (NUM_BITS_IN_ONE_BYTE - shift));
+        }
+
+        /// Gets the page whose first line starts at firstBit, rendering it if it is not cached
+        Page const& getPage(uint64_t const firstBit) {
+            if (auto const itr = pageLookup.find(firstBit); itr != pageLookup.end()) {
+                pages.splice(pages.begin(), pages, itr->second);
+                return pages.front();
+            }
+            if (pages.size() == cacheCapacity) {
+                pageLookup.erase(pages.back().firstBit);
+                pages.pop_back();
+            }
+            pages.push_front(renderPage(firstBit));
+            pageLookup.emplace(firstBit, pages.begin());
+            return pages.front();
+        }
+
+        [[nodiscard]]
+        Page renderPage(uint64_t const firstBit) const {
+            Page page {firstBit, {}, {}};
+            uint64_t const bitsPerLine = bytesPerLine * NUM_BITS_IN_ONE_BYTE;
+            for (size_t line = 0; line < linesPerPage; ++line) {
+                uint64_t const lineBit = firstBit + line * bitsPerLine;
+                if (lineBit + NUM_BITS_IN_ONE_BYTE > getNumBits()) break;
+                offsetPresenter.formatTo(page.text, Bits<uint64_t>{lineBit / NUM_BITS_IN_ONE_BYTE});
+                if (auto const shift = lineBit % NUM_BITS_IN_ONE_BYTE) {
+                    page.text.push_back('+');
+                    page.text.push_back(static_cast<char>('0' + shift));
+                }
+                page.text.push_back(':');
+                auto const numBytes = std::min<uint64_t>(bytesPerLine, (getNumBits() - lineBit) / NUM_BITS_IN_ONE_BYTE);
+                for (uint64_t i = 0; i < numBytes; ++i) {
+                    page.text.push_back(' ');
+                    bytePresenter.formatTo(page.text, Bits<uint8_t>{readByte(lineBit + i * NUM_BITS_IN_ONE_BYTE)});
+                }
+                page.text.push_back('\n');
+                page.lineEnds.push_back(page.text.size());
+            }
+            return page;
+        }
+
+        BitsPresenter bytePresenter;
+        BitsPresenter offsetPresenter;
+        size_t bytesPerLine;
+        size_t linesPerPage;
+        size_t cacheCapacity;
+        std::span<std::byte const> bytes;
+        std::list<Page> pages;
+        std::unordered_map<uint64_t, std::list<Page>::iterator> pageLookup;
+    };
+}
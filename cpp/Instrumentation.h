@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// @brief Opt-in counters for the library's hot paths.
+///
+/// Define BITS_AND_BYTES_INSTRUMENTATION (CMake option ENABLE_INSTRUMENTATION) to enable them. When disabled, every
+/// counting function is an empty inline function and no thread-local state is created.
+///
+/// Each thread increments its own counters without synchronization. snapshot() aggregates the counters of all live
+/// threads together with those of threads that have exited.
+///
+/// The macro changes the definitions of inline functions throughout the library, so it must be defined the same way
+/// in every translation unit of a program. The CMake option sets it on the bytes target and every target linking it
+namespace bits_and_bytes::instrumentation {
+
+#ifdef BITS_AND_BYTES_INSTRUMENTATION
+    inline bool constexpr ENABLED {true};
+#else
+    inline bool constexpr ENABLED {false};
+#endif
+
+    /// Upper bounds on the number of enumerators of Format and BitUnit, used to size the counter tables
+    size_t constexpr MAX_FORMATS {8};
+    size_t constexpr MAX_BIT_UNITS {4};
+
+    template<typename Counter>
+    struct BasicCounters {
+        /// Bit strings parsed, indexed by the Format of the input
+        std::array<Counter, MAX_FORMATS> parses{};
+        /// Values rendered, indexed by Format and then BitUnit of the output
+        std::array<std::array<Counter, MAX_BIT_UNITS>, MAX_FORMATS> renders{};
+        /// Characters of rendered output
+        Counter bytesProduced{};
+        /// Heap allocations made through a CountingMemoryResource
+        Counter allocations{};
+        /// Bytes requested by those allocations
+        Counter bytesAllocated{};
+        /// BitFormatException and OutOfRangeException objects created
+        Counter exceptions{};
+        /// Calls to Bits<T>::getString() that reused the cached presenter output
+        Counter presenterCacheHits{};
+        /// Calls to Bits<T>::getString() that had to format the bits
+        Counter presenterCacheMisses{};
+    };
+
+    /// Aggregated counter values
+    using Counters = BasicCounters<uint64_t>;
+
+    namespace detail {
+        using AtomicCounters = BasicCounters<std::atomic<uint64_t>>;
+
+        template<typename To, typename From, typename Operation>
+        void combine(To& to, From const& from, Operation&& operation) {
+            auto const apply = [&operation](auto& toCounter, auto const& fromCounter) {
+                operation(toCounter, fromCounter);
+            };
+            for (size_t format = 0; format < MAX_FORMATS; ++format) {
+                apply(to.parses[format], from.parses[format]);
+                for (size_t bitUnit = 0; bitUnit < MAX_BIT_UNITS; ++bitUnit) {
+                    apply(to.renders[format][bitUnit], from.renders[format][bitUnit]);
+                }
+            }
+            apply(to.bytesProduced, from.bytesProduced);
+            apply(to.allocations, from.allocations);
+            apply(to.bytesAllocated, from.bytesAllocated);
+            apply(to.exceptions, from.exceptions);
+            apply(to.presenterCacheHits, from.presenterCacheHits);
+            apply(to.presenterCacheMisses, from.presenterCacheMisses);
+        }
+
+        inline void addTo(Counters& total, AtomicCounters const& counters) {
+            combine(total, counters, [](uint64_t& to, std::atomic<uint64_t> const& from) {
+                to += from.load(std::memory_order_relaxed);
+            });
+        }
+
+        class Registry {
+        public:
+            void add(AtomicCounters* counters) {
+                std::scoped_lock lock {mutex};
+                live.push_back(counters);
+            }
+
+            void retire(AtomicCounters* counters) {
+                std::scoped_lock lock {mutex};
+                addTo(retired, *counters);
+                std::erase(live, counters);
+            }
+
+            Counters snapshot() {
+                std::scoped_lock lock {mutex};
+                Counters total {retired};
+                for (auto const* counters : live) {
+                    addTo(total, *counters);
+                }
+                return total;
+            }
+
+            void reset() {
+                std::scoped_lock lock {mutex};
+                retired = {};
+                for (auto* counters : live) {
+                    combine(*counters, *counters, [](std::atomic<uint64_t>& to, std::atomic<uint64_t> const&) {
+                        to.store(0, std::memory_order_relaxed);
+                    });
+                }
+            }
+
+        private:
+            std::mutex mutex;
+            std::vector<AtomicCounters*> live;
+            Counters retired{};
+        };
+
+        inline Registry& getRegistry() {
+            static Registry registry;
+            return registry;
+        }
+
+        /// Per-thread counters that register themselves on first use and fold into the retired totals on thread exit
+        struct ThreadCounters {
+            ThreadCounters() {
+                getRegistry().add(&counters);
+            }
+
+            ~ThreadCounters() {
+                getRegistry().retire(&counters);
+            }
+
+            ThreadCounters(ThreadCounters const&) = delete;
+            ThreadCounters& operator=(ThreadCounters const&) = delete;
+
+            AtomicCounters counters;
+        };
+
+        inline AtomicCounters& getThreadCounters() {
+            thread_local ThreadCounters threadCounters;
+            return threadCounters.counters;
+        }
+
+        // Only the owning thread writes its counters, so a relaxed load and store is enough; other threads only read
+        inline void increment(std::atomic<uint64_t>& counter, uint64_t const amount = 1U) {
+            counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+    }
+
+    /// Counts a parse of a bit string in the given format
+    template<typename FormatType>
+    void countParse(FormatType const format) {
+        if constexpr (ENABLED) {
+            detail::increment(detail::getThreadCounters().parses[static_cast<size_t>(format)]);
+        }
+    }
+
+    /// Counts a value rendered in the given format and bit unit, producing the given number of characters
+    template<typename FormatType, typename BitUnitType>
+    void countRender(FormatType const format, BitUnitType const bitUnit, size_t const numCharacters) {
+        if constexpr (ENABLED) {
+            auto& counters = detail::getThreadCounters();
+            detail::increment(counters.renders[static_cast<size_t>(format)][static_cast<size_t>(bitUnit)]);
+            detail::increment(counters.bytesProduced, numCharacters);
+        }
+    }
+
+    /// Counts an exception created by the library
+    inline void countException() {
+        if constexpr (ENABLED) {
+            detail::increment(detail::getThreadCounters().exceptions);
+        }
+    }
+
+    /// Counts a lookup of the cached formatted output in Bits<T>
+    inline void countPresenterCacheLookup(bool const hit) {
+        if constexpr (ENABLED) {
+            auto& counters = detail::getThreadCounters();
+            detail::increment(hit ? counters.presenterCacheHits : counters.presenterCacheMisses);
+        }
+    }
+
+    /// @brief Memory resource that counts the allocations made through it and forwards them to its upstream resource.
+    ///
+    /// Pass it to the std::pmr overloads, e.g. Bits<T>{bitString, &resource} or bits.getString(&resource), to count
+    /// the heap allocations the library makes on those paths. Strings short enough for the small string buffer do
+    /// not allocate and are not counted. Without instrumentation the resource only forwards
+    class CountingMemoryResource final : public std::pmr::memory_resource {
+    public:
+        explicit CountingMemoryResource(std::pmr::memory_resource* const upstream = std::pmr::get_default_resource())
+            : upstream(upstream) {
+        }
+
+    private:
+        void* do_allocate(size_t const bytes, size_t const alignment) override {
+            if constexpr (ENABLED) {
+                auto& counters = detail::getThreadCounters();
+                detail::increment(counters.allocations);
+                detail::increment(counters.bytesAllocated, bytes);
+            }
+            return upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* const pointer, size_t const bytes, size_t const alignment) override {
+            upstream->deallocate(pointer, bytes, alignment);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& another) const noexcept override {
+            return this == &another;
+        }
+
+        std::pmr::memory_resource* upstream;
+    };
+
+    /// Gets the counters aggregated across all threads. Always zero when instrumentation is disabled
+    [[nodiscard]]
+    inline Counters snapshot() {
+        if constexpr (ENABLED) {
+            return detail::getRegistry().snapshot();
+        }
+        return {};
+    }
+
+    /// Sets all counters to zero. Increments made concurrently by other threads may be lost
+    inline void reset() {
+        if constexpr (ENABLED) {
+            detail::getRegistry().reset();
+        }
+    }
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Bits.h"
+
+namespace bits_and_bytes {
+
+    /// @brief Marks which bytes of the object representation of a trivially copyable type are padding.
+    ///
+    /// A layout is built from the type's members, either from pointers to all of its data members or from a function
+    /// that assigns all of them. Members that are themselves structs are treated as opaque, so padding inside them is
+    /// not detected unless the members are described down to scalars
+    template<typename ObjectType>
+    class ObjectLayout final {
+    static_assert(std::is_trivially_copyable_v<ObjectType>);
+    public:
+        /// Creates a layout for a type without padding
+        [[nodiscard]]
+        static ObjectLayout withoutPadding()
+        requires std::has_unique_object_representations_v<ObjectType> {
+            return ObjectLayout{};
+        }
+
+        /// @brief Creates a layout from pointers to every data member; bytes not covered by a member are padding.
+        ///
+        /// Usage: ObjectLayout<Message>::fromMembers(&Message::id, &Message::flags, &Message::payload)
+        template<typename... MemberTypes>
+        [[nodiscard]]
+        static ObjectLayout fromMembers(MemberTypes ObjectType::*... members)
+        requires std::is_default_constructible_v<ObjectType> {
+            ObjectType const object{};
+            ObjectLayout layout;
+            layout.padding.fill(true);
+            auto const markMember = [&layout, &object](auto const& member) {
+                auto const offset = reinterpret_cast<std::byte const*>(&member) -
+                                    reinterpret_cast<std::byte const*>(&object);
+                std::fill_n(layout.padding.begin() + offset, sizeof(member), false);
+            };
+            (markMember(object.*members), ...);
+            return layout;
+        }
+
+        /// @brief Creates a layout by comparing two instances whose storage was filled with different bytes before
+        /// the given function assigned every data member.
+        ///
+        /// Bytes that differ were not written by the function and are padding.
+        /// Usage: ObjectLayout<Message>::fromAssignment([](Message& m) { m = {1, 2, 3.0}; })
+        /// Assigning a whole aggregate may copy padding too; assign the members one by one if padding is not found
+        template<typename AssignMembers>
+        [[nodiscard]]
+        static ObjectLayout fromAssignment(AssignMembers&& assignMembers)
+        requires std::is_default_constructible_v<ObjectType> && std::is_invocable_v<AssignMembers, ObjectType&> {
+            auto const fillAndAssign = [&assignMembers](std::byte const fill) {
+                std::array<std::byte, sizeof(ObjectType)> bytes;
+                bytes.fill(fill);
+                ObjectType object;
+                std::memcpy(&object, bytes.data(), sizeof(ObjectType));
+                assignMembers(object);
+                std::memcpy(bytes.data(), &object, sizeof(ObjectType));
+                return bytes;
+            };
+            auto const zeroFilled = fillAndAssign(std::byte{0x00});
+            auto const oneFilled = fillAndAssign(std::byte{0xFF});
+            ObjectLayout layout;
+            for (size_t i = 0; i < sizeof(ObjectType); ++i) {
+                layout.padding[i] = zeroFilled[i] != oneFilled[i];
+            }
+            return layout;
+        }
+
+        /// Checks if the byte at the given offset is padding
+        [[nodiscard]]
+        bool isPadding(size_t const offset) const {
+            return padding[offset];
+        }
+
+        /// Gets the number of padding bytes in the object representation
+        [[nodiscard]]
+        size_t getNumPaddingBytes() const {
+            return std::ranges::count(padding, true);
+        }
+
+    private:
+        ObjectLayout() = default;
+
+        std::array<bool, sizeof(ObjectType)> padding{};
+    };
+
+    /// @brief Renders the object representation of trivially copyable objects byte by byte and audits their padding.
+    ///
+    /// Bytes are rendered in memory order with the inspector's string format, separated by spaces, and padding bytes
+    /// are enclosed in square brackets, e.g. "0x01 [0x00] [0x7F] 0x00 0x00 0x00 0x2A" with hexadecimal bytes.
+    /// Non-zero padding in data that leaves the process usually means uninitialized memory is leaking
+    template<typename ObjectType>
+    class ObjectInspector final {
+    static_assert(std::is_trivially_copyable_v<ObjectType>);
+    public:
+        explicit ObjectInspector(ObjectLayout<ObjectType> const& layout,
+                                 StringFormat const& stringFormat = BitsBase::stringFormat)
+            : layout(layout)
+            , presenter(stringFormat, NUM_BITS_IN_ONE_BYTE) {
+            std::array<std::byte, NUM_WORDS * sizeof(uint64_t)> mask{};
+            for (size_t i = 0; i < sizeof(ObjectType); ++i) {
+                mask[i] = layout.isPadding(i) ? std::byte{0xFF} : std::byte{0x00};
+            }
+            std::memcpy(paddingMask.data(), mask.data(), mask.size());
+        }
+
+        /// Gets the layout the inspector marks padding with
+        [[nodiscard]]
+        ObjectLayout<ObjectType> const& getLayout() const {
+            return layout;
+        }
+
+        /// Renders the object representation of an object
+        [[nodiscard]]
+        std::string render(ObjectType const& object) const {
+            std::string output;
+            renderTo(output, object);
+            return output;
+        }
+
+        /// Renders the object representation of each object on its own line
+        [[nodiscard]]
+        std::string render(std::span<ObjectType const> const objects) const {
+            std::string output;
+            for (auto const& object : objects) {
+                if (!output.empty()) output.push_back('\n');
+                renderTo(output, object);
+            }
+            return output;
+        }
+
+        /// Checks if any padding byte of the object is not zero
+        [[nodiscard]]
+        bool hasNonZeroPadding(ObjectType const& object) const {
+            return hasNonZeroPaddingAt(reinterpret_cast<std::byte const*>(&object));
+        }
+
+        /// @brief Finds the objects with non-zero padding.
+        ///
+        /// Each object is copied into a word-aligned buffer and its words are masked with the padding mask and
+        /// combined, which the compiler vectorizes, so the scan runs close to memory bandwidth
+        /// @returns Indices of the objects with a non-zero padding byte, in ascending order
+        [[nodiscard]]
+        std::vector<size_t> findNonZeroPadding(std::span<ObjectType const> const objects) const {
+            std::vector<size_t> leaks;
+            if (!layout.getNumPaddingBytes()) return leaks;
+            auto const* bytes = reinterpret_cast<std::byte const*>(objects.data());
+            for (size_t i = 0; i < objects.size(); ++i) {
+                if (hasNonZeroPaddingAt(bytes + i * sizeof(ObjectType))) {
+                    leaks.push_back(i);
+                }
+            }
+            return leaks;
+        }
+
+    private:
+        static constexpr size_t NUM_WORDS {(sizeof(ObjectType) + sizeof(uint64_t) - 1U) / sizeof(uint64_t)};
+
+        [[nodiscard]]
+        bool hasNonZeroPaddingAt(std::byte const* object) const {
+            std::array<uint64_t, NUM_WORDS> words{};
+            std::memcpy(words.data(), object, sizeof(ObjectType));
+            uint64_t leaked{};
+            for (size_t i = 0; i < NUM_WORDS; ++i) {
+                leaked |= words[i] & paddingMask[i];
+            }
+            return leaked;
+        }
+
+        void renderTo(std::string& output, ObjectType const& object) const {
+            std::array<uint8_t, sizeof(ObjectType)> bytes;
+            std::memcpy(bytes.data(), &object, sizeof(ObjectType));
+            for (size_t i = 0; i < bytes.size(); ++i) {
+                if (i) output.push_back(' ');
+                if (layout.isPadding(i)) output.push_back('[');
+                presenter.formatTo(output, Bits<uint8_t>{bytes[i]});
+                if (layout.isPadding(i)) output.push_back(']');
+            }
+        }
+
+        ObjectLayout<ObjectType> layout;
+        BitsPresenter presenter;
+        std::array<uint64_t, NUM_WORDS> paddingMask{};
+    };
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "Bits.h"
+
+namespace bits_and_bytes {
+
+    /// @brief Tracks which words of a changing memory region differ between successive snapshots and keeps the
+    /// rendered text of every word.
+    ///
+    /// update() copies the region a block at a time, compares each block with the previous snapshot and re-renders
+    /// only the words of the blocks that changed. The text of unchanged words is kept from earlier updates. Every word
+    /// is rendered into a fixed-width slot sized for the longest text the string format produces, so the text cache
+    /// never reallocates. Trailing bytes that do not fill a word are ignored
+    template<typename NumericType>
+    class DirtyWordTracker final {
+    static_assert(std::is_integral_v<NumericType>);
+    public:
+        /// Bytes compared per step
+        static constexpr size_t BLOCK_SIZE {64};
+
+        DirtyWordTracker(size_t const regionSize, StringFormat const& stringFormat)
+            : presenter(stringFormat, sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE)
+            , numWords(regionSize / sizeof(NumericType))
+            , snapshot(numWords * sizeof(NumericType))
+            , slotWidth(getMaxTextLength())
+            , text(numWords * slotWidth, ' ')
+            , textLengths(numWords) {
+            dirtyWords.reserve(numWords);
+        }
+
+        /// @brief Takes a snapshot of the region and re-renders the words that changed since the last snapshot.
+        ///
+        /// All words are reported as changed by the first update
+        /// @returns Indices of the changed words in ascending order
+        std::span<size_t const> update(std::span<std::byte const> const region) {
+            dirtyWords.clear();
+            auto const numBytes = std::min(region.size(), snapshot.size());
+            alignas(BLOCK_SIZE) std::array<std::byte, BLOCK_SIZE> block;
+            for (size_t offset = 0; offset < numBytes; offset += BLOCK_SIZE) {
+                auto const blockSize = std::min(BLOCK_SIZE, numBytes - offset);
+                std::memcpy(block.data(), region.data() + offset, blockSize);
+                if (initialized && blockSize == BLOCK_SIZE && areBlocksEqual(block.data(), snapshot.data() + offset)) {
+                    continue;
+                }
+                for (size_t wordOffset = 0; wordOffset < blockSize; wordOffset += sizeof(NumericType)) {
+                    auto* previous = snapshot.data() + offset + wordOffset;
+                    if (initialized && !std::memcmp(previous, block.data() + wordOffset, sizeof(NumericType))) {
+                        continue;
+                    }
+                    std::memcpy(previous, block.data() + wordOffset, sizeof(NumericType));
+                    auto const wordIndex = (offset + wordOffset) / sizeof(NumericType);
+                    render(wordIndex);
+                    dirtyWords.push_back(wordIndex);
+                }
+            }
+            initialized = true;
+            return dirtyWords;
+        }
+
+        /// Gets the number of words in the region
+        [[nodiscard]]
+        size_t getNumWords() const {
+            return numWords;
+        }
+
+        /// Gets the value of a word in the latest snapshot
+        [[nodiscard]]
+        NumericType getWord(size_t const wordIndex) const {
+            NumericType word;
+            std::memcpy(&word, snapshot.data() + wordIndex * sizeof(NumericType), sizeof(NumericType));
+            return word;
+        }
+
+        /// Gets the rendered text of a word in the latest snapshot
+        [[nodiscard]]
+        std::string_view getText(size_t const wordIndex) const {
+            return {text.data() + wordIndex * slotWidth, textLengths[wordIndex]};
+        }
+
+        /// Appends a line "<word index> <text>" for each word that changed in the latest update
+        template<typename Allocator>
+        void appendUpdates(std::basic_string<char, std::char_traits<char>, Allocator>& output) const {
+            std::array<char, std::numeric_limits<size_t>::digits10 + 1> index;
+            for (auto const wordIndex : dirtyWords) {
+                auto const end = std::to_chars(index.data(), index.data() + index.size(), wordIndex).ptr;
+                output.append(index.data(), end);
+                output.push_back(' ');
+                output.append(getText(wordIndex));
+                output.push_back('\n');
+            }
+        }
+
+    private:
+        [[nodiscard]]
+        static bool areBlocksEqual(std::byte const* block, std::byte const* previous) {
+#if defined(__AVX2__)
+            auto const load = [](std::byte const* data, size_t const offset) {
+                return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + offset));
+            };
+            __m256i const low = _mm256_cmpeq_epi8(load(block, 0), load(previous, 0));
+            __m256i const high = _mm256_cmpeq_epi8(load(block, 32), load(previous, 32));
+            return _mm256_movemask_epi8(_mm256_and_si256(low, high)) == -1;
+#else
+            // OR of the XOR of every 64-bit word pair; written branch-free so that it vectorizes
+            uint64_t difference{};
+            for (size_t i = 0; i < BLOCK_SIZE; i += sizeof(uint64_t)) {
+                uint64_t a, b;
+                std::memcpy(&a, block + i, sizeof(uint64_t));
+                std::memcpy(&b, previous + i, sizeof(uint64_t));
+                difference |= a ^ b;
+            }
+            return !difference;
+#endif
+        }
+
+        [[nodiscard]]
+        size_t getMaxTextLength() const {
+            // Every bit set yields the most digits in the positional formats; the byte encodings have a fixed width
+            std::string longest;
+            presenter.formatTo(longest, Bits<NumericType>{static_cast<NumericType>(~std::make_unsigned_t<NumericType>{})});
+            return longest.size();
+        }
+
+        void render(size_t const wordIndex) {
+            scratch.clear();
+            presenter.formatTo(scratch, Bits<NumericType>{getWord(wordIndex)});
+            std::memcpy(text.data() + wordIndex * slotWidth, scratch.data(), scratch.size());
+            textLengths[wordIndex] = static_cast<uint8_t>(scratch.size());
+        }
+
+        BitsPresenter presenter;
+        size_t numWords;
+        std::vector<std::byte> snapshot;
+        size_t slotWidth;
+        std::string text;
+        std::vector<uint8_t> textLengths;
+        std::vector<size_t> dirtyWords;
+        std::string scratch;
+        bool initialized{};
+    };
+
+    /// @brief Live bit view of a POSIX shared-memory object.
+    ///
+    /// Maps the object read-only. Each call to poll() snapshots the region and re-renders only the words that the
+    /// producer changed since the previous poll
+    /// @see DirtyWordTracker
+    template<typename NumericType>
+    class SharedMemoryWatcher final {
+    public:
+        /// Opens and maps the shared-memory object with the given name, e.g. "/producer"
+        /// @exception std::system_error the object cannot be opened or mapped
+        explicit SharedMemoryWatcher(std::string const& name, StringFormat const& stringFormat = BitsBase::stringFormat)
+            : region(map(name))
+            , tracker(region.size(), stringFormat) {}
+
+        SharedMemoryWatcher(SharedMemoryWatcher const&) = delete;
+        SharedMemoryWatcher& operator=(SharedMemoryWatcher const&) = delete;
+
+        ~SharedMemoryWatcher() {
+            if (!region.empty()) {
+                ::munmap(const_cast<std::byte*>(region.data()), region.size());
+            }
+        }
+
+        /// Snapshots the region and re-renders the changed words
+        /// @returns Indices of the changed words in ascending order
+        std::span<size_t const> poll() {
+            return tracker.update(region);
+        }
+
+        /// Gets the tracker holding the latest snapshot and the rendered text of every word
+        [[nodiscard]]
+        DirtyWordTracker<NumericType> const& getTracker() const {
+            return tracker;
+        }
+
+    private:
+        static std::span<std::byte const> map(std::string const& name) {
+            int const fileDescriptor = ::shm_open(name.c_str(), O_RDONLY, 0);
+            if (fileDescriptor < 0) {
+                throw std::system_error(errno, std::generic_category(), std::format("Unable to open {}", name));
+            }
+            struct stat status {};
+            if (::fstat(fileDescriptor, &status) < 0) {
+                auto const error = errno;
+                ::close(fileDescriptor);
+                throw std::system_error(error, std::generic_category(), std::format("Unable to stat {}", name));
+            }
+            auto const size = static_cast<size_t>(status.st_size);
+            void* mapping = size ? ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0) : nullptr;
+            auto const error = errno;
+            ::close(fileDescriptor); // The mapping stays valid after the descriptor is closed
+            if (mapping == MAP_FAILED) {
+                throw std::system_error(error, std::generic_category(), std::format("Unable to map {}", name));
+            }
+            return {static_cast<std::byte const*>(mapping), size};
+        }
+
+        std::span<std::byte const> region;
+        DirtyWordTracker<NumericType> tracker;
+    };
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <format>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#include "Bits.h"
+
+namespace bits_and_bytes {
+
+    /// Bit-level transforms that can be applied to values before they are rendered
+    enum class Transform : uint8_t {
+        None,
+        ByteSwap,
+        BitReverse,
+        GrayEncode,
+        GrayDecode
+    };
+
+    /// Reverses the order of the bytes of a value
+    template<std::integral NumericType>
+    [[nodiscard]]
+    constexpr NumericType byteSwap(NumericType const value) {
+        return std::byteswap(value);
+    }
+
+    namespace detail {
+        inline constexpr std::array<uint8_t, 256> REVERSED_BYTES = [] {
+            std::array<uint8_t, 256> table{};
+            for (size_t byte = 0; byte < table.size(); ++byte) {
+                for (size_t bit = 0; bit < NUM_BITS_IN_ONE_BYTE; ++bit) {
+                    table[byte] |= static_cast<uint8_t>(((byte >> bit) & 1U) << (NUM_BITS_IN_ONE_BYTE - 1U - bit));
+                }
+            }
+            return table;
+        }();
+    }
+
+    /// Reverses the order of the bits of a value, so the most significant bit becomes the least significant
+    template<std::integral NumericType>
+    [[nodiscard]]
+    constexpr NumericType reverseBits(NumericType const value) {
+        auto bytes = std::bit_cast<std::array<uint8_t, sizeof(NumericType)>>(std::byteswap(value));
+        for (auto& byte : bytes) {
+            byte = detail::REVERSED_BYTES[byte];
+        }
+        return std::bit_cast<NumericType>(bytes);
+    }
+
+    /// Converts a value to its reflected binary Gray code, in which successive values differ in exactly one bit
+    template<std::integral NumericType>
+    [[nodiscard]]
+    constexpr NumericType grayEncode(NumericType const value) {
+        using UnsignedNumericType = std::make_unsigned_t<NumericType>;
+        auto const bits = static_cast<UnsignedNumericType>(value);
+        return static_cast<NumericType>(bits ^ (bits >> 1U));
+    }
+
+    /// Converts a reflected binary Gray code back to the value it encodes
+    template<std::integral NumericType>
+    [[nodiscard]]
+    constexpr NumericType grayDecode(NumericType const value) {
+        using UnsignedNumericType = std::make_unsigned_t<NumericType>;
+        auto bits = static_cast<UnsignedNumericType>(value);
+        // Prefix XOR from the most significant bit down, in log2(width) steps
+        for (size_t shift = 1; shift < sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE; shift <<= 1U) {
+            bits ^= static_cast<UnsignedNumericType>(bits >> shift);
+        }
+        return static_cast<NumericType>(bits);
+    }
+
+    /// Applies a transform to a value
+    template<std::integral NumericType>
+    [[nodiscard]]
+    constexpr NumericType applyTransform(Transform const transform, NumericType const value) {
+        switch (transform) {
+            case Transform::ByteSwap:
+                return byteSwap(value);
+            case Transform::BitReverse:
+                return reverseBits(value);
+            case Transform::GrayEncode:
+                return grayEncode(value);
+            case Transform::GrayDecode:
+                return grayDecode(value);
+            case Transform::None:
+                break;
+        }
+        return value;
+    }
+
+    /// Undoes a transform, i.e. invertTransform(t, applyTransform(t, value)) == value
+    template<std::integral NumericType>
+    [[nodiscard]]
+    constexpr NumericType invertTransform(Transform const transform, NumericType const value) {
+        switch (transform) {
+            case Transform::GrayEncode:
+                return grayDecode(value);
+            case Transform::GrayDecode:
+                return grayEncode(value);
+            default: // Byte swap and bit reversal are their own inverses
+                return applyTransform(transform, value);
+        }
+    }
+
+    /// @brief Parses a bit string that was rendered from transformed values and recovers the original value.
+    ///
+    /// Accepts every form Bits<T> parses
+    /// @exception BitFormatException the string is not a valid bit string
+    /// @exception OutOfRangeException the string has more bits than the type
+    template<std::integral NumericType>
+    [[nodiscard]]
+    NumericType parseTransformed(std::string_view const bitString, Transform const transform) {
+        return invertTransform(transform, static_cast<NumericType>(Bits<NumericType>{bitString}));
+    }
+
+    namespace detail {
+#if defined(__SSSE3__)
+        /// pshufb control that reverses the order of the bytes within each element of the given size
+        template<size_t ElementSize>
+        inline constexpr std::array<uint8_t, SIXTEEN> BYTE_REVERSAL_SHUFFLE = [] {
+            std::array<uint8_t, SIXTEEN> shuffle{};
+            for (size_t i = 0; i < shuffle.size(); ++i) {
+                shuffle[i] = static_cast<uint8_t>(i / ElementSize * ElementSize + ElementSize - 1U - i % ElementSize);
+            }
+            return shuffle;
+        }();
+
+        /// Reverses the bytes, and optionally the bits within each byte, of every element in whole 16-byte blocks.
+        /// Bits within a byte are reversed by looking up both nibbles in a 16-entry table with pshufb
+        /// @returns Number of bytes processed
+        template<size_t ElementSize, bool ReverseBitsInBytes>
+        size_t reverseBlocks(std::byte const* input, std::byte* output, size_t const numBytes) {
+            __m128i const shuffle = _mm_loadu_si128(reinterpret_cast<__m128i const*>(BYTE_REVERSAL_SHUFFLE<ElementSize>.data()));
+            __m128i const nibbleMask = _mm_set1_epi8(0x0F);
+            __m128i const reversedNibbles = _mm_setr_epi8(0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+                                                          0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF);
+            size_t offset{};
+            for (; offset + SIXTEEN <= numBytes; offset += SIXTEEN) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(input + offset));
+                if constexpr (ReverseBitsInBytes) {
+                    __m128i const low = _mm_and_si128(block, nibbleMask);
+                    __m128i const high = _mm_and_si128(_mm_srli_epi16(block, NUM_BITS_IN_ONE_NIBBLE), nibbleMask);
+                    block = _mm_or_si128(_mm_slli_epi16(_mm_shuffle_epi8(reversedNibbles, low), NUM_BITS_IN_ONE_NIBBLE),
+                                         _mm_shuffle_epi8(reversedNibbles, high));
+                }
+                if constexpr (ElementSize > 1U) {
+                    block = _mm_shuffle_epi8(block, shuffle);
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset), block);
+            }
+            return offset;
+        }
+#endif
+
+        template<typename NumericType>
+        void checkOutputSize(std::span<NumericType const> const input, std::span<NumericType> const output) {
+            if (output.size() < input.size()) {
+                throw OutOfRangeException(std::format("Output of {} values cannot hold {} transformed values",
+                                                      output.size(), input.size()));
+            }
+        }
+
+        template<Transform transform, typename NumericType>
+        void transformValues(std::span<NumericType const> const input, std::span<NumericType> const output) {
+            checkOutputSize(input, output);
+            size_t first{};
+#if defined(__SSSE3__)
+            if constexpr (transform == Transform::ByteSwap || transform == Transform::BitReverse) {
+                // Input and output are either disjoint or the same, so whole blocks can be loaded and stored in turn
+                first = reverseBlocks<sizeof(NumericType), transform == Transform::BitReverse>(
+                    reinterpret_cast<std::byte const*>(input.data()), reinterpret_cast<std::byte*>(output.data()),
+                    input.size_bytes()) / sizeof(NumericType);
+            }
+#endif
+            for (size_t i = first; i < input.size(); ++i) {
+                output[i] = applyTransform(transform, input[i]);
+            }
+        }
+    }
+
+    /// Reverses the bytes of every value. The output must hold at least as many values as the input and may be the
+    /// input itself
+    /// @exception OutOfRangeException the output is smaller than the input
+    template<std::integral NumericType>
+    void byteSwap(std::span<std::type_identity_t<NumericType> const> const input,
+                  std::span<NumericType> const output) {
+        detail::transformValues<Transform::ByteSwap>(input, output);
+    }
+
+    /// Reverses the bytes of every value in place
+    template<std::integral NumericType>
+    void byteSwap(std::span<NumericType> const values) {
+        detail::transformValues<Transform::ByteSwap>(std::span<NumericType const>{values}, values);
+    }
+
+    /// Reverses the bits of every value. The output must hold at least as many values as the input and may be the
+    /// input itself
+    /// @exception OutOfRangeException the output is smaller than the input
+    template<std::integral NumericType>
+    void reverseBits(std::span<std::type_identity_t<NumericType> const> const input,
+                  std::span<NumericType> const output) {
+        detail::transformValues<Transform::BitReverse>(input, output);
+    }
+
+    /// Reverses the bits of every value in place
+    template<std::integral NumericType>
+    void reverseBits(std::span<NumericType> const values) {
+        detail::transformValues<Transform::BitReverse>(std::span<NumericType const>{values}, values);
+    }
+
+    /// Converts every value to Gray code. The output must hold at least as many values as the input and may be the
+    /// input itself
+    /// @exception OutOfRangeException the output is smaller than the input
+    template<std::integral NumericType>
+    void grayEncode(std::span<std::type_identity_t<NumericType> const> const input,
+                  std::span<NumericType> const output) {
+        detail::transformValues<Transform::GrayEncode>(input, output);
+    }
+
+    /// Converts every value to Gray code in place
+    template<std::integral NumericType>
+    void grayEncode(std::span<NumericType> const values) {
+        detail::transformValues<Transform::GrayEncode>(std::span<NumericType const>{values}, values);
+    }
+
+    /// Converts every Gray code back to the value it encodes. The output must hold at least as many values as the
+    /// input and may be the input itself
+    /// @exception OutOfRangeException the output is smaller than the input
+    template<std::integral NumericType>
+    void grayDecode(std::span<std::type_identity_t<NumericType> const> const input,
+                  std::span<NumericType> const output) {
+        detail::transformValues<Transform::GrayDecode>(input, output);
+    }
+
+    /// Converts every Gray code back to the value it encodes in place
+    template<std::integral NumericType>
+    void grayDecode(std::span<NumericType> const values) {
+        detail::transformValues<Transform::GrayDecode>(std::span<NumericType const>{values}, values);
+    }
+}
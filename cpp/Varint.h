@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+#include "Bits.h"
+
+namespace bits_and_bytes {
+
+    /// Interpretation of the payload of a varint (LEB128) as used by Protocol Buffers
+    enum class VarintEncoding : uint8_t {
+        /// The payload is the value; negative values are sign extended to 64 bits and take ten bytes
+        Plain,
+        /// The payload is the zigzag encoding of a signed value, so values of small magnitude take few bytes
+        ZigZag
+    };
+
+    /// Longest varint, which holds 64 payload bits
+    size_t constexpr MAX_VARINT_LENGTH {10};
+
+    /// Maps signed values to unsigned values so that values of small magnitude map to small values:
+    /// 0 → 0, -1 → 1, 1 → 2, -2 → 3, ...
+    template<std::signed_integral NumericType>
+    [[nodiscard]]
+    constexpr std::make_unsigned_t<NumericType> zigzagEncode(NumericType const value) {
+        using UnsignedNumericType = std::make_unsigned_t<NumericType>;
+        auto const signMask = static_cast<UnsignedNumericType>(value >> (sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE - 1U));
+        return static_cast<UnsignedNumericType>(static_cast<UnsignedNumericType>(value) << 1U) ^ signMask;
+    }
+
+    /// Inverse of zigzagEncode
+    template<std::unsigned_integral NumericType>
+    [[nodiscard]]
+    constexpr std::make_signed_t<NumericType> zigzagDecode(NumericType const value) {
+        auto const signMask = static_cast<NumericType>(-static_cast<NumericType>(value & 1U));
+        return static_cast<std::make_signed_t<NumericType>>(static_cast<NumericType>(value >> 1U) ^ signMask);
+    }
+
+    /// Gets the number of bytes in the varint encoding of a payload
+    [[nodiscard]]
+    constexpr size_t getVarintLength(uint64_t const payload) {
+        return std::max<size_t>(1U, (std::bit_width(payload) + 6U) / 7U);
+    }
+
+    namespace detail {
+        uint64_t constexpr CONTINUATION_BITS {0x8080'8080'8080'8080};
+        uint64_t constexpr PAYLOAD_BITS {0x7F7F'7F7F'7F7F'7F7F};
+        uint8_t constexpr CONTINUATION_BIT {0x80};
+        uint8_t constexpr PAYLOAD_MASK {0x7F};
+        uint8_t constexpr NUM_PAYLOAD_BITS_IN_ONE_BYTE {7};
+
+        template<std::integral NumericType>
+        uint64_t getVarintPayload(NumericType const value, VarintEncoding const encoding) {
+            return encoding == VarintEncoding::ZigZag
+                ? zigzagEncode(static_cast<int64_t>(value))
+                : static_cast<uint64_t>(value);
+        }
+
+        /// Loads up to eight bytes as a little-endian word; missing bytes read as zero
+        inline uint64_t loadLittleEndianWord(std::byte const* data, size_t const available) {
+            uint64_t word{};
+            std::memcpy(&word, data, std::min(available, sizeof(uint64_t)));
+            if constexpr (std::endian::native == std::endian::big) {
+                word = std::byteswap(word);
+            }
+            return word;
+        }
+
+        /// Packs the low seven bits of each byte of the word into a contiguous payload, least significant group first
+        inline uint64_t compactPayload(uint64_t const word) {
+#if defined(__BMI2__)
+            return _pext_u64(word, PAYLOAD_BITS);
+#else
+            // Merge neighbouring groups pairwise: 7-bit groups into 14-bit, then 28-bit, then a single 56-bit payload
+            uint64_t payload = word & PAYLOAD_BITS;
+            payload = ((payload & 0x7F00'7F00'7F00'7F00) >> 1U) | (payload & 0x007F'007F'007F'007F);
+            payload = ((payload & 0x3FFF'0000'3FFF'0000) >> 2U) | (payload & 0x0000'3FFF'0000'3FFF);
+            payload = ((payload & 0x0FFF'FFFF'0000'0000) >> 4U) | (payload & 0x0000'0000'0FFF'FFFF);
+            return payload;
+#endif
+        }
+
+        struct RawVarint {
+            uint64_t payload;
+            size_t length;
+        };
+
+        /// @brief Decodes the varint that starts at the given offset.
+        ///
+        /// Eight bytes are loaded at once. The lowest byte without a continuation bit ends the varint, so its length
+        /// is found with a single count of trailing zeroes and the payload groups are packed without a loop. Only the
+        /// rare nine and ten byte varints read further bytes
+        /// @exception BitFormatException the varint is truncated or longer than ten bytes
+        /// @exception OutOfRangeException the payload exceeds 64 bits
+        inline RawVarint decodeRawVarint(std::span<std::byte const> const input, size_t const offset) {
+            auto const* data = input.data() + offset;
+            size_t const available = input.size() - offset;
+            auto const truncated = [offset]() {
+                return BitFormatException(std::format("Varint at byte {} is truncated", offset));
+            };
+            uint64_t const word = loadLittleEndianWord(data, available);
+            // Bytes past the end of the input read as zero, so a varint shorter than eight bytes always ends here
+            if (uint64_t const ends = ~word & CONTINUATION_BITS) {
+                size_t const length = std::countr_zero(ends) / NUM_BITS_IN_ONE_BYTE + 1U;
+                if (length > available) throw truncated();
+                uint64_t const lengthMask = length == sizeof(uint64_t)
+                    ? std::numeric_limits<uint64_t>::max()
+                    : (uint64_t{1} << (length * NUM_BITS_IN_ONE_BYTE)) - 1U;
+                return {compactPayload(word & lengthMask), length};
+            }
+            if (available <= sizeof(uint64_t)) throw truncated();
+            auto const ninth = std::to_integer<uint8_t>(data[sizeof(uint64_t)]);
+            uint64_t const payload = compactPayload(word) |
+                                     static_cast<uint64_t>(ninth & PAYLOAD_MASK) << (8U * NUM_PAYLOAD_BITS_IN_ONE_BYTE);
+            if (!(ninth & CONTINUATION_BIT)) return {payload, sizeof(uint64_t) + 1U};
+            if (available < MAX_VARINT_LENGTH) throw truncated();
+            auto const tenth = std::to_integer<uint8_t>(data[MAX_VARINT_LENGTH - 1U]);
+            if (tenth & CONTINUATION_BIT) {
+                throw BitFormatException(std::format("Varint at byte {} is longer than {} bytes", offset,
+                                                     MAX_VARINT_LENGTH));
+            }
+            if (tenth > 1U) {
+                throw OutOfRangeException(std::format("Varint at byte {} exceeds 64 bits", offset));
+            }
+            return {payload | static_cast<uint64_t>(tenth) << (SIXTYFOUR - 1U), MAX_VARINT_LENGTH};
+        }
+
+        /// Converts a payload to the value it encodes
+        /// @exception OutOfRangeException the value does not fit in the type
+        template<std::integral NumericType>
+        NumericType toVarintValue(uint64_t const payload, VarintEncoding const encoding, size_t const offset) {
+            bool const fits = encoding == VarintEncoding::ZigZag
+                ? std::in_range<NumericType>(zigzagDecode(payload))
+                : std::is_signed_v<NumericType>
+                    ? std::in_range<NumericType>(static_cast<int64_t>(payload))
+                    : std::in_range<NumericType>(payload);
+            if (!fits) {
+                throw OutOfRangeException(std::format("Varint at byte {} exceeds type's width of {} bytes", offset,
+                                                      sizeof(NumericType)));
+            }
+            return encoding == VarintEncoding::ZigZag
+                ? static_cast<NumericType>(zigzagDecode(payload))
+                : static_cast<NumericType>(payload);
+        }
+    }
+
+    /// Appends the varint encoding of a value. ZigZag encoding is meant for signed types
+    template<std::integral NumericType>
+    void appendVarint(std::vector<std::byte>& output, NumericType const value,
+                      VarintEncoding const encoding = VarintEncoding::Plain) {
+        uint64_t payload = detail::getVarintPayload(value, encoding);
+        while (payload > detail::PAYLOAD_MASK) {
+            output.push_back(static_cast<std::byte>((payload & detail::PAYLOAD_MASK) | detail::CONTINUATION_BIT));
+            payload >>= detail::NUM_PAYLOAD_BITS_IN_ONE_BYTE;
+        }
+        output.push_back(static_cast<std::byte>(payload));
+    }
+
+    /// Counts the varints in a buffer, i.e. the bytes without a continuation bit, eight bytes at a time
+    [[nodiscard]]
+    inline size_t countVarints(std::span<std::byte const> const input) {
+        size_t count{}, offset{};
+        for (; offset + sizeof(uint64_t) <= input.size(); offset += sizeof(uint64_t)) {
+            count += std::popcount(~detail::loadLittleEndianWord(input.data() + offset, sizeof(uint64_t)) &
+                                   detail::CONTINUATION_BITS);
+        }
+        for (; offset < input.size(); ++offset) {
+            count += !(std::to_integer<uint8_t>(input[offset]) & detail::CONTINUATION_BIT);
+        }
+        return count;
+    }
+
+    /// @brief Decodes a buffer of consecutive varints, appending the values to the output.
+    ///
+    /// Suited to scanning large captures: the output grows once, by the number of varints in the buffer
+    /// @exception BitFormatException a varint is truncated or longer than ten bytes
+    /// @exception OutOfRangeException a value does not fit in the type
+    template<std::integral NumericType>
+    void decodeVarints(std::span<std::byte const> const input, std::vector<NumericType>& output,
+                       VarintEncoding const encoding = VarintEncoding::Plain) {
+        output.reserve(output.size() + countVarints(input));
+        for (size_t offset = 0; offset < input.size();) {
+            auto const [payload, length] = detail::decodeRawVarint(input, offset);
+            output.push_back(detail::toVarintValue<NumericType>(payload, encoding, offset));
+            offset += length;
+        }
+    }
+
+    /// Decodes a buffer of consecutive varints
+    /// @exception BitFormatException a varint is truncated or longer than ten bytes
+    /// @exception OutOfRangeException a value does not fit in the type
+    template<std::integral NumericType>
+    [[nodiscard]]
+    std::vector<Bits<NumericType>> decodeVarints(std::span<std::byte const> const input,
+                                                 VarintEncoding const encoding = VarintEncoding::Plain) {
+        std::vector<NumericType> values;
+        decodeVarints(input, values, encoding);
+        std::vector<Bits<NumericType>> bits;
+        bits.reserve(values.size());
+        for (auto const value : values) {
+            bits.emplace_back(value);
+        }
+        return bits;
+    }
+
+    /// @brief Renders each varint of a buffer on its own line, marking its continuation bits and payload groups.
+    ///
+    /// Every byte is shown in wire order as its continuation bit and its seven payload bits separated by '|',
+    /// followed by the decoded value in the given string format, e.g. "1|0101100 0|0000010 = 100101100" for 300.
+    /// The first payload group holds the least significant bits
+    /// @exception BitFormatException a varint is truncated or longer than ten bytes
+    /// @exception OutOfRangeException a value does not fit in the type
+    template<std::integral NumericType>
+    [[nodiscard]]
+    std::string renderVarints(std::span<std::byte const> const input,
+                              StringFormat const& stringFormat = BitsBase::stringFormat,
+                              VarintEncoding const encoding = VarintEncoding::Plain) {
+        BitsPresenter const presenter{stringFormat, sizeof(NumericType) * NUM_BITS_IN_ONE_BYTE};
+        std::string output;
+        for (size_t offset = 0; offset < input.size();) {
+            auto const [payload, length] = detail::decodeRawVarint(input, offset);
+            auto const value = detail::toVarintValue<NumericType>(payload, encoding, offset);
+            if (offset) output.push_back('\n');
+            for (size_t i = 0; i < length; ++i) {
+                auto const byte = std::to_integer<uint8_t>(input[offset + i]);
+                if (i) output.push_back(' ');
+                output.push_back(byte & detail::CONTINUATION_BIT ? '1' : '0');
+                output.push_back('|');
+                for (size_t bit = detail::NUM_PAYLOAD_BITS_IN_ONE_BYTE; bit-- > 0;) {
+                    output.push_back((byte >> bit) & 1U ? '1' : '0');
+                }
+            }
+            output.append(" = ");
+            presenter.formatTo(output, Bits<NumericType>{value});
+            offset += length;
+        }
+        return output;
+    }
+}
@@ -0,0 +1,34 @@
+// Typical client translation unit: parses, renders and streams Bits<T> for every integer type
+#include "Bits.h"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace bb = bits_and_bytes;
+
+namespace {
+    template<typename NumericType>
+    std::string probe(NumericType const value) {
+        bb::Bits<NumericType> const bits {value};
+        std::cout << bits;
+        std::string output {bits.getString()};
+        output += bb::Bits<NumericType>{"0x1"}.getString();
+        output += bb::Bits<NumericType>{"0110"}.getString();
+        return output;
+    }
+}
+
+int main() {
+    std::string output;
+    output += probe(int8_t{-1});
+    output += probe(uint8_t{1});
+    output += probe(int16_t{-1});
+    output += probe(uint16_t{1});
+    output += probe(int32_t{-1});
+    output += probe(uint32_t{1});
+    output += probe(int64_t{-1});
+    output += probe(uint64_t{1});
+    output += probe('a');
+    std::cout << output << '\n';
+}
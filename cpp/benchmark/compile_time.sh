@@ -0,0 +1,38 @@
+#!/usr/bin/env bash
+# Compares the time to compile a typical client translation unit in header-only mode with the time to compile it
+# against the explicit instantiations in bytes_static.
+#
+# Usage: compile_time.sh [repetitions] [extra compiler flags...], e.g. compile_time.sh 5 -O2
+# Honours CXX (default c++). Extra flags follow -O0, so they override it. Prints the mean wall-clock time of each mode
+# in seconds, computed with awk so that only POSIX tools are needed
+set -euo pipefail
+shopt -s inherit_errexit # Fail when a compile inside $(measure) fails
+
+repetitions=${1:-5}
+shift || true
+compiler=${CXX:-c++}
+cppDirectory=$(cd "$(dirname "$0")/.." && pwd)
+probe="$cppDirectory/benchmark/CompileTimeProbe.cpp"
+output=$(mktemp -d)
+trap 'rm -rf "$output"' EXIT
+
+compile() {
+    "$compiler" -std=c++23 -O0 -Wall -Werror -I"$cppDirectory" "$@" -c "$probe" -o "$output/probe.o"
+}
+
+measure() {
+    local start end
+    compile "$@" # Warm the file system cache
+    start=$(date +%s.%N)
+    for ((i = 0; i < repetitions; ++i)); do
+        compile "$@"
+    done
+    end=$(date +%s.%N)
+    awk -v start="$start" -v end="$end" -v repetitions="$repetitions" \
+        'BEGIN { printf "%.3f", (end - start) / repetitions }'
+}
+
+headerOnly=$(measure "$@")
+externTemplates=$(measure -DBITS_AND_BYTES_EXTERN_TEMPLATES "$@")
+echo "header-only:      ${headerOnly}s"
+echo "extern templates: ${externTemplates}s"
@@ -0,0 +1,116 @@
+// Module interface unit exporting the public API of the library. Built by the bytes_module target where the compiler
+// and generator support modules; the headers remain usable on their own
+module;
+
+#include "BaseEncoding.h"
+#include "BitStatistics.h"
+#include "Bits.h"
+#include "BitsSink.h"
+#include "BitsView.h"
+#include "FileViewer.h"
+#include "ObjectInspector.h"
+#include "SharedMemoryWatcher.h"
+#include "Transforms.h"
+#include "Varint.h"
+
+export module bits_and_bytes;
+
+export namespace bits_and_bytes {
+    // Bits.h, BitsPresenter.h and Common.h
+    using bits_and_bytes::Bits;
+    using bits_and_bytes::BitsBase;
+    using bits_and_bytes::BitsPresenter;
+    using bits_and_bytes::NoFlush;
+    using bits_and_bytes::noFlush;
+    using bits_and_bytes::operator<<;
+    using bits_and_bytes::Order;
+    using bits_and_bytes::Format;
+    using bits_and_bytes::HexFormat;
+    using bits_and_bytes::BitUnit;
+    using bits_and_bytes::LeadingZeroes;
+    using bits_and_bytes::StringFormat;
+    using bits_and_bytes::DEFAULT_STRING_FORMAT;
+    using bits_and_bytes::BitFormatException;
+    using bits_and_bytes::OutOfRangeException;
+    using bits_and_bytes::trim;
+    using bits_and_bytes::nibbleAsBits;
+    using bits_and_bytes::asHexDigit;
+    using bits_and_bytes::normalize;
+    using bits_and_bytes::canonicalize;
+    using bits_and_bytes::validateHex;
+    using bits_and_bytes::canonicalizeBinaryString;
+    using bits_and_bytes::convertHexToCanonicalBinaryString;
+    using bits_and_bytes::convertOctalToCanonicalBinaryString;
+    using bits_and_bytes::convertBinaryToHexString;
+    using bits_and_bytes::zeroExtend;
+
+    // BaseEncoding.h
+    using bits_and_bytes::BASE64_ALPHABET;
+    using bits_and_bytes::BASE32_ALPHABET;
+    using bits_and_bytes::getBase64EncodedLength;
+    using bits_and_bytes::getBase32EncodedLength;
+    using bits_and_bytes::encodeBase64;
+    using bits_and_bytes::encodeBase32;
+    using bits_and_bytes::decodeBase64;
+    using bits_and_bytes::decodeBase32;
+
+    // BitStatistics.h
+    using bits_and_bytes::countSetBits;
+    using bits_and_bytes::BitStatistics;
+
+    // BitsView.h and BitsSink.h
+    using bits_and_bytes::BitsView;
+    using bits_and_bytes::ChunkedBitsRenderer;
+    using bits_and_bytes::BitsSink;
+    namespace views {
+        using bits_and_bytes::views::AsBits;
+        using bits_and_bytes::views::as_bits;
+    }
+
+    // FileViewer.h and SharedMemoryWatcher.h
+    using bits_and_bytes::FileViewer;
+    using bits_and_bytes::DirtyWordTracker;
+    using bits_and_bytes::SharedMemoryWatcher;
+
+    // ObjectInspector.h
+    using bits_and_bytes::ObjectLayout;
+    using bits_and_bytes::ObjectInspector;
+
+    // Transforms.h
+    using bits_and_bytes::Transform;
+    using bits_and_bytes::byteSwap;
+    using bits_and_bytes::reverseBits;
+    using bits_and_bytes::grayEncode;
+    using bits_and_bytes::grayDecode;
+    using bits_and_bytes::applyTransform;
+    using bits_and_bytes::invertTransform;
+    using bits_and_bytes::parseTransformed;
+
+    // Varint.h
+    using bits_and_bytes::VarintEncoding;
+    using bits_and_bytes::zigzagEncode;
+    using bits_and_bytes::zigzagDecode;
+    using bits_and_bytes::getVarintLength;
+    using bits_and_bytes::appendVarint;
+    using bits_and_bytes::countVarints;
+    using bits_and_bytes::decodeVarints;
+    using bits_and_bytes::renderVarints;
+
+    // Instrumentation.h
+    namespace instrumentation {
+        using bits_and_bytes::instrumentation::BasicCounters;
+        using bits_and_bytes::instrumentation::Counters;
+        using bits_and_bytes::instrumentation::ENABLED;
+        using bits_and_bytes::instrumentation::CountingMemoryResource;
+        using bits_and_bytes::instrumentation::snapshot;
+        using bits_and_bytes::instrumentation::reset;
+    }
+}
+
+// The std::formatter specializations for Bits<T> and BitStatistics<T> are partial specializations declared in the
+// global module fragment, and specializations cannot be exported. Naming them in the module purview makes them
+// decl-reachable, so they are kept in the module and std::format finds them for importers of the module
+namespace bits_and_bytes::detail {
+    using BitsFormatter [[maybe_unused]] = std::formatter<Bits<int>>;
+    using BitStatisticsFormatter [[maybe_unused]] = std::formatter<BitStatistics<int>>;
+}
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include "BaseEncoding.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+namespace {
+    std::span<std::byte const> asBytes(std::string_view const text) {
+        return std::as_bytes(std::span{text});
+    }
+
+    std::string asString(std::vector<std::byte> const& bytes) {
+        return {reinterpret_cast<char const*>(bytes.data()), bytes.size()};
+    }
+
+    std::vector<std::byte> makeRandomBytes(size_t const count) {
+        std::mt19937 generator{7}; // NOLINT: Fixed seed keeps the test deterministic
+        std::vector<std::byte> bytes(count);
+        std::ranges::generate(bytes, [&generator] { return static_cast<std::byte>(generator()); });
+        return bytes;
+    }
+}
+
+TEST(BaseEncoding, WillEncodeBase64TestVectors) {
+    ASSERT_EQ("", bb::encodeBase64(asBytes("")));
+    ASSERT_EQ("Zg==", bb::encodeBase64(asBytes("f")));
+    ASSERT_EQ("Zm8=", bb::encodeBase64(asBytes("fo")));
+    ASSERT_EQ("Zm9v", bb::encodeBase64(asBytes("foo")));
+    ASSERT_EQ("Zm9vYg==", bb::encodeBase64(asBytes("foob")));
+    ASSERT_EQ("Zm9vYmE=", bb::encodeBase64(asBytes("fooba")));
+    ASSERT_EQ("Zm9vYmFy", bb::encodeBase64(asBytes("foobar")));
+    ASSERT_EQ("TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu", bb::encodeBase64(asBytes("Many hands make light work.")));
+}
+
+TEST(BaseEncoding, WillDecodeBase64TestVectors) {
+    ASSERT_EQ("", asString(bb::decodeBase64("")));
+    ASSERT_EQ("f", asString(bb::decodeBase64("Zg==")));
+    ASSERT_EQ("fo", asString(bb::decodeBase64("Zm8=")));
+    ASSERT_EQ("foobar", asString(bb::decodeBase64("Zm9vYmFy")));
+    ASSERT_EQ("Many hands make light work.", asString(bb::decodeBase64("TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu")));
+}
+
+TEST(BaseEncoding, WillEncodeAndDecodeBase32TestVectors) {
+    std::vector<std::pair<std::string, std::string>> const vectors {
+        {"", ""}, {"f", "MY======"}, {"fo", "MZXQ===="}, {"foo", "MZXW6==="}, {"foob", "MZXW6YQ="},
+        {"fooba", "MZXW6YTB"}, {"foobar", "MZXW6YTBOI======"}
+    };
+    for (auto const& [decoded, encoded] : vectors) {
+        ASSERT_EQ(encoded, bb::encodeBase32(asBytes(decoded)));
+        ASSERT_EQ(decoded, asString(bb::decodeBase32(encoded)));
+    }
+}
+
+TEST(BaseEncoding, WillRoundTripLargeBuffers) {
+    for (size_t const size : {1U, 11U, 12U, 16U, 17U, 100U, 4096U, 10001U}) {
+        auto const bytes = makeRandomBytes(size);
+        ASSERT_EQ(bytes, bb::decodeBase64(bb::encodeBase64(bytes))) << "Buffer size " << size;
+        ASSERT_EQ(bytes, bb::decodeBase32(bb::encodeBase32(bytes))) << "Buffer size " << size;
+        ASSERT_EQ(bb::getBase64EncodedLength(size), bb::encodeBase64(bytes).size());
+        ASSERT_EQ(bb::getBase32EncodedLength(size), bb::encodeBase32(bytes).size());
+    }
+}
+
+TEST(BaseEncoding, WillAppendToExistingOutput) {
+    std::string output {"data:"};
+    bb::encodeBase64(asBytes("foo"), output);
+    bb::encodeBase32(asBytes("f"), output);
+    ASSERT_EQ("data:Zm9vMY======", output);
+}
+
+TEST(BaseEncoding, WillRejectInvalidBase64) {
+    auto const assertRejected = [](std::string_view const invalid, std::string_view const message) {
+        ASSERT_THROW(
+            try {
+                auto ret [[maybe_unused]] = bb::decodeBase64(invalid);
+            } catch (bb::BitFormatException const& ex) {
+                ASSERT_EQ(message, ex.what());
+                throw;
+            }, bb::BitFormatException) << invalid;
+    };
+    assertRejected("Zg=", "Zg= is not a valid Base64 value: length 3 is not a multiple of 4.");
+    assertRejected("Zg===", "Zg=== is not a valid Base64 value: length 5 is not a multiple of 4.");
+    for (auto const* invalid : {"Z===", "Zm9*", "Zh==", "Zm=v", "===="}) {
+        assertRejected(invalid, std::format("{} is not a valid Base64 value: invalid block at character 0.", invalid));
+    }
+    assertRejected("Zm9vZm9*", "Zm9vZm9* is not a valid Base64 value: invalid block at character 4.");
+    assertRejected("Zm9vAAAA====", "Zm9vAAAA==== is not a valid Base64 value: invalid block at character 8.");
+
+    // Long inputs are not copied into the message
+    auto valid = bb::encodeBase64(makeRandomBytes(300));
+    valid[37] = '-';
+    valid[90] = '-';
+    assertRejected(valid, "Input of 400 characters is not a valid Base64 value: invalid block at character 36.");
+}
+
+TEST(BaseEncoding, WillRejectInvalidBase32) {
+    for (auto const* invalid : {"MY=====", "MZX=====", "my======", "MZXW6YQ1", "MZ======"}) {
+        ASSERT_THROW(auto ret [[maybe_unused]] = bb::decodeBase32(invalid), bb::BitFormatException) << invalid;
+    }
+}
@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+
+#include "BitStatistics.h"
+
+#include <bit>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+class BitStatistics : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+        bb::BitsBase::stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+        bb::BitsBase::stringFormat.bitUnit = bb::BitUnit::Nibble;
+    }
+
+    template<typename NumericType>
+    static std::vector<NumericType> makeRandomValues(size_t const count) {
+        std::mt19937_64 generator{42}; // NOLINT: Fixed seed keeps the test deterministic
+        std::vector<NumericType> values(count);
+        std::ranges::generate(values, [&generator] { return static_cast<NumericType>(generator()); });
+        return values;
+    }
+};
+
+TEST_F(BitStatistics, WillCountSetBitsInBuffersOfAnySize) {
+    for (size_t const size : {0U, 1U, 7U, 8U, 127U, 128U, 1000U, 4099U}) {
+        auto const values = makeRandomValues<uint8_t>(size);
+        uint64_t expected{};
+        for (auto const value : values) {
+            expected += std::popcount(value);
+        }
+        ASSERT_EQ(expected, bb::countSetBits(std::as_bytes(std::span{values}))) << "Buffer size " << size;
+    }
+}
+
+TEST_F(BitStatistics, WillCountSetBitsPerPosition) {
+    std::vector<uint16_t> const values {0x0001, 0x8001, 0x8003, 0x0000};
+    bb::BitStatistics<uint16_t> const statistics{values};
+    ASSERT_EQ(4, statistics.getCount());
+    ASSERT_EQ(6, statistics.getPopCount());
+    ASSERT_EQ(3, statistics.getSetBitCount(0));
+    ASSERT_EQ(1, statistics.getSetBitCount(1));
+    ASSERT_EQ(0, statistics.getSetBitCount(2));
+    ASSERT_EQ(2, statistics.getSetBitCount(15));
+}
+
+TEST_F(BitStatistics, WillMatchScalarCountsForLargeSignedInputs) {
+    auto const values = makeRandomValues<int32_t>(1000);
+    bb::BitStatistics<int32_t> const statistics{values};
+    for (uint8_t bit = 0; bit < 32; ++bit) {
+        auto const expected = std::ranges::count_if(values, [bit](int32_t const value) {
+            return (static_cast<uint32_t>(value) >> bit) & 1U;
+        });
+        ASSERT_EQ(expected, statistics.getSetBitCount(bit)) << "Bit position " << static_cast<int>(bit);
+    }
+}
+
+TEST_F(BitStatistics, WillBuildLeadingAndTrailingZeroesHistograms) {
+    std::vector<uint8_t> const values {0x00, 0x01, 0x80, 0x10, 0x18};
+    bb::BitStatistics<uint8_t> const statistics{values};
+    auto const& leading = statistics.getLeadingZeroesHistogram();
+    auto const& trailing = statistics.getTrailingZeroesHistogram();
+    ASSERT_EQ(1, leading[8]);
+    ASSERT_EQ(1, leading[7]);
+    ASSERT_EQ(1, leading[0]);
+    ASSERT_EQ(2, leading[3]);
+    ASSERT_EQ(1, trailing[8]);
+    ASSERT_EQ(1, trailing[0]);
+    ASSERT_EQ(1, trailing[7]);
+    ASSERT_EQ(1, trailing[4]);
+    ASSERT_EQ(1, trailing[3]);
+}
+
+TEST_F(BitStatistics, WillComputeByteEntropy) {
+    std::vector<uint8_t> constant(64, 0xAB);
+    ASSERT_DOUBLE_EQ(0.0, bb::BitStatistics<uint8_t>{constant}.getByteEntropy());
+    std::vector<uint8_t> uniform(256);
+    std::iota(uniform.begin(), uniform.end(), 0);
+    ASSERT_DOUBLE_EQ(8.0, bb::BitStatistics<uint8_t>{uniform}.getByteEntropy());
+    std::vector<uint16_t> const twoSymbols {0x00FF, 0xFF00};
+    ASSERT_DOUBLE_EQ(1.0, bb::BitStatistics<uint16_t>{twoSymbols}.getByteEntropy());
+}
+
+TEST_F(BitStatistics, WillDetectStuckBits) {
+    std::vector<uint8_t> const values {0x81, 0xC1, 0x85};
+    bb::BitStatistics<uint8_t> const statistics{values};
+    ASSERT_EQ("0011 1010", statistics.getStuckAtZeroBits());
+    ASSERT_EQ("1000 0001", statistics.getStuckAtOneBits());
+    ASSERT_EQ(0, bb::BitStatistics<uint8_t>{}.getStuckAtOneBits().getValue());
+}
+
+TEST_F(BitStatistics, WillProduceSameResultsWhenParallelized) {
+    auto const values = makeRandomValues<uint64_t>(bb::BitStatistics<uint64_t>::PARALLEL_THRESHOLD * 2 + 17);
+    bb::BitStatistics<uint64_t> const parallel{values};
+    bb::BitStatistics<uint64_t> sequential{std::span{values}.first(values.size() / 2)};
+    sequential.merge(bb::BitStatistics<uint64_t>{std::span{values}.subspan(values.size() / 2)});
+    ASSERT_EQ(values.size(), parallel.getCount());
+    ASSERT_EQ(bb::countSetBits(std::as_bytes(std::span{values})), parallel.getPopCount());
+    for (uint8_t bit = 0; bit < 64; ++bit) {
+        ASSERT_EQ(sequential.getSetBitCount(bit), parallel.getSetBitCount(bit));
+    }
+    ASSERT_EQ(sequential.getLeadingZeroesHistogram(), parallel.getLeadingZeroesHistogram());
+    ASSERT_DOUBLE_EQ(sequential.getByteEntropy(), parallel.getByteEntropy());
+}
+
+TEST_F(BitStatistics, WillFormatUsingCurrentStringFormat) {
+    bb::BitsBase::stringFormat.format = bb::Format::Hexadecimal;
+    bb::BitsBase::stringFormat.bitUnit = bb::BitUnit::None;
+    std::vector<uint8_t> const values {0x0F, 0x0F};
+    ASSERT_EQ("Count: 2\nPopulation count: 8\nStuck at zero: 0xF0\nStuck at one: 0x0F\nByte entropy: 0",
+        std::format("{}", bb::BitStatistics<uint8_t>{values}));
+}
@@ -114,6 +114,9 @@ TEST_F(Bits, WillBuildFromHexaDecimalString) {
         }, std::runtime_error
     );
     ASSERT_EQ("1111 1111", bb::Bits<uint8_t>{"0xFF"});
+    // Every bit of the widest unsigned values is significant
+    ASSERT_EQ(0xFFFF'FFFFU, bb::Bits<uint32_t>{"0xFFFFFFFF"}.getValue());
+    ASSERT_EQ(0xFFFF'FFFF'FFFF'FFFFU, bb::Bits<uint64_t>{"0xFFFFFFFFFFFFFFFF"}.getValue());
     ASSERT_THROW(
         try {
             bb::Bits<int8_t>{"0x"};
@@ -157,4 +160,77 @@ TEST_F(Bits, WillBuildBitSequenceFromNegativeNumbers) {
     ASSERT_EQ("1111 1000", bb::Bits<int8_t>{-8});
     ASSERT_EQ("1111 1111", bb::Bits<int8_t>{-1});
     ASSERT_EQ("1111 1111 1111 1111", bb::Bits<int16_t>{-1});
-}
\ No newline at end of file
+}
+
+TEST_F(Bits, WillProduceOctalOutput) {
+    bb::BitsBase::stringFormat.format = bb::Format::Octal;
+    ASSERT_EQ("0o000", bb::Bits{uint8_t{0}});
+    ASSERT_EQ("0o377", bb::Bits{int8_t{-1}});
+    ASSERT_EQ("0o000644", bb::Bits{uint16_t{0644}});
+    disableLeadingZeroes();
+    ASSERT_EQ("0o0", bb::Bits{uint8_t{0}});
+    ASSERT_EQ("0o755", bb::Bits{int32_t{0755}});
+    ASSERT_EQ("0o1777777777777777777777", bb::Bits{uint64_t{0xFFFF'FFFF'FFFF'FFFF}});
+}
+
+TEST_F(Bits, WillProduceBase64AndBase32Output) {
+    bb::BitsBase::stringFormat.format = bb::Format::Base64;
+    ASSERT_EQ("base64:AA==", bb::Bits{uint8_t{0}});
+    ASSERT_EQ("base64:AGZvbw==", bb::Bits{int32_t{0x666F6F}});
+    ASSERT_EQ("base64://8=", bb::Bits{int16_t{-1}});
+    bb::BitsBase::stringFormat.format = bb::Format::Base32;
+    ASSERT_EQ("base32:ABTG63Y=", bb::Bits{uint32_t{0x666F6F}});
+    ASSERT_EQ("base32:AAAAAAAAAAAAA===", bb::Bits{uint64_t{0}});
+}
+
+TEST_F(Bits, WillBuildFromOctalString) {
+    ASSERT_EQ(0644, bb::Bits<uint16_t>{"0o644"}.getValue());
+    ASSERT_EQ(0755, bb::Bits<int32_t>{"0o 755"}.getValue());
+    ASSERT_EQ(-1, bb::Bits<int8_t>{"0o377"}.getValue());
+    ASSERT_EQ(255, bb::Bits<uint8_t>{"0o377"}.getValue());
+    ASSERT_THROW(
+        try {
+            bb::Bits<int8_t>{"0o777"};
+        } catch (std::runtime_error const& ex) {
+            ASSERT_STREQ(ex.what(), "Octal value 0o777 exceeds type's width of 8 bits");
+            throw;
+        }, bb::OutOfRangeException);
+    ASSERT_EQ(0xFFFF'FFFF'FFFF'FFFFU, bb::Bits<uint64_t>{"0o1777777777777777777777"}.getValue());
+    ASSERT_THROW(bb::Bits<uint64_t>{"0o2000000000000000000000"}, bb::OutOfRangeException);
+    ASSERT_THROW(bb::Bits<uint64_t>{"0o2000000000000000000001"}, bb::OutOfRangeException);
+    ASSERT_THROW(bb::Bits<int64_t>{"0o2000000000000000000000"}, bb::OutOfRangeException);
+    ASSERT_THROW(
+        try {
+            bb::Bits<int8_t>{"0o78"};
+        } catch (std::runtime_error const& ex) {
+            ASSERT_STREQ(ex.what(), "0o78 is not a valid octal value.");
+            throw;
+        }, std::runtime_error
+    );
+}
+
+TEST_F(Bits, WillBuildFromBase64AndBase32Strings) {
+    ASSERT_EQ(0x666F6F, bb::Bits<int32_t>{"base64:AGZvbw=="}.getValue());
+    ASSERT_EQ(0x666F6F, bb::Bits<int32_t>{"base64:Zm9v"}.getValue());
+    ASSERT_EQ(-1, bb::Bits<int16_t>{"base64://8="}.getValue());
+    ASSERT_EQ(0x666F6F, bb::Bits<uint32_t>{"base32:MZXW6==="}.getValue());
+    ASSERT_THROW(
+        try {
+            bb::Bits<int8_t>{"base64:Zm8="};
+        } catch (std::runtime_error const& ex) {
+            ASSERT_STREQ(ex.what(), "Base64 value Zm8= exceeds type's width of 1 bytes");
+            throw;
+        }, std::runtime_error
+    );
+    ASSERT_THROW(bb::Bits<int32_t>{"base64:Zm9*"}, bb::BitFormatException);
+    ASSERT_THROW(
+        try {
+            bb::Bits<int32_t>{"base64:"};
+        } catch (std::runtime_error const& ex) {
+            ASSERT_STREQ(ex.what(), "base64: is not a valid Base64 value.");
+            throw;
+        }, bb::BitFormatException
+    );
+    ASSERT_THROW(bb::Bits<int32_t>{"base32:  "}, bb::BitFormatException);
+}
+
@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+
+#include "BitsSink.h"
+
+#include <array>
+#include <cstdio>
+#include <sstream>
+#include <streambuf>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+namespace {
+    /// Stream buffer that counts how many times the stream is flushed
+    class FlushCountingBuffer final : public std::stringbuf {
+    public:
+        int flushCount{};
+    protected:
+        int sync() override {
+            ++flushCount;
+            return std::stringbuf::sync();
+        }
+    };
+}
+
+class BitsSink : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+        stringFormat = bb::DEFAULT_STRING_FORMAT;
+        stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+    }
+
+protected:
+    bb::StringFormat stringFormat {bb::DEFAULT_STRING_FORMAT};
+};
+
+TEST_F(BitsSink, WillBufferUntilFlushed) {
+    std::ostringstream output;
+    bb::BitsSink sink{output, ", ", stringFormat};
+    sink << bb::Bits{uint8_t{1}} << bb::Bits{int16_t{-1}};
+    ASSERT_TRUE(output.str().empty());
+    sink.flush();
+    ASSERT_EQ("00000001, 1111111111111111, ", output.str());
+}
+
+TEST_F(BitsSink, WillWriteWhenCapacityIsReached) {
+    std::ostringstream output;
+    bb::BitsSink sink{output, "\n", stringFormat, 18};
+    sink << bb::Bits{uint8_t{0xF0}};
+    ASSERT_TRUE(output.str().empty());
+    sink << bb::Bits{uint8_t{0x0F}};
+    ASSERT_EQ("11110000\n00001111\n", output.str());
+}
+
+TEST_F(BitsSink, WillFlushOnDestruction) {
+    std::ostringstream output;
+    std::array<uint16_t, 3> constexpr values {0xA, 0xB, 0xC};
+    stringFormat.format = bb::Format::Hexadecimal;
+    {
+        bb::BitsSink sink{output, " ", stringFormat, 8};
+        sink.write(values);
+    }
+    ASSERT_EQ("0x000A 0x000B 0x000C ", output.str());
+}
+
+TEST_F(BitsSink, WillWriteToFileDescriptor) {
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(nullptr, file);
+    std::vector<int32_t> const values(1000, -2);
+    {
+        bb::BitsSink sink{fileno(file), "\n", bb::DEFAULT_STRING_FORMAT, 256};
+        sink.write(values);
+    }
+    std::rewind(file);
+    std::string contents(40000, '\0');
+    contents.resize(std::fread(contents.data(), 1, contents.size(), file));
+    std::fclose(file);
+    ASSERT_EQ(33000, contents.size());
+    ASSERT_EQ(std::string(31, '1') + "0\n", contents.substr(0, 33));
+}
+
+TEST_F(BitsSink, WillThrowWhenFileDescriptorIsInvalid) {
+    bb::BitsSink sink{-1};
+    sink << bb::Bits{uint8_t{1}};
+    ASSERT_THROW(sink.flush(), std::system_error);
+}
+
+TEST_F(BitsSink, WillStreamWithoutFlushing) {
+    FlushCountingBuffer buffer;
+    std::ostream output{&buffer};
+    output << bb::noFlush(bb::Bits{uint8_t{5}}) << bb::noFlush(bb::Bits{uint8_t{6}});
+    ASSERT_EQ(0, buffer.flushCount);
+    ASSERT_EQ("101\n110\n", buffer.str());
+    output << bb::Bits{uint8_t{7}};
+    ASSERT_EQ(1, buffer.flushCount);
+}
+
+TEST_F(BitsSink, WillStreamNoFlushWrapperThatOutlivesBits) {
+    FlushCountingBuffer buffer;
+    std::ostream output{&buffer};
+    auto const wrapper = bb::noFlush(bb::Bits{uint8_t{9}});
+    output << wrapper;
+    ASSERT_EQ("1001\n", buffer.str());
+}
@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+
+#include "BitsView.h"
+
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+class BitsView : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+    }
+
+    static std::vector<bb::StringFormat> allStringFormats() {
+        std::vector<bb::StringFormat> stringFormats;
+        for (auto const format : {bb::Format::Binary, bb::Format::Hexadecimal}) {
+            for (auto const hexFormat : {bb::HexFormat::UpperCase, bb::HexFormat::LowerCase}) {
+                for (auto const bitUnit : {bb::BitUnit::Nibble, bb::BitUnit::Byte, bb::BitUnit::None}) {
+                    for (auto const leadingZeroes : {bb::LeadingZeroes::Suppress, bb::LeadingZeroes::Include}) {
+                        stringFormats.push_back({bb::Order::BigEndian, format, hexFormat, bitUnit, leadingZeroes, '\''});
+                    }
+                }
+            }
+        }
+        return stringFormats;
+    }
+
+    template<typename NumericType>
+    static void expectFormatToMatchesGetString() {
+        std::array constexpr values {
+            NumericType{0}, NumericType{1}, NumericType{10}, NumericType{16}, NumericType{0x5A},
+            std::numeric_limits<NumericType>::max(), std::numeric_limits<NumericType>::min(),
+            static_cast<NumericType>(std::numeric_limits<NumericType>::max() / 3)
+        };
+        for (auto const& stringFormat : allStringFormats()) {
+            bb::BitsBase::stringFormat = stringFormat;
+            bb::BitsPresenter const presenter{stringFormat, sizeof(NumericType) * bb::NUM_BITS_IN_ONE_BYTE};
+            for (auto const value : values) {
+                std::string output;
+                presenter.formatTo(output, bb::Bits<NumericType>{value});
+                ASSERT_EQ(bb::Bits<NumericType>{value}.getString(), output);
+            }
+        }
+    }
+};
+
+TEST_F(BitsView, WillFormatToSameTextAsGetString) {
+    expectFormatToMatchesGetString<uint8_t>();
+    expectFormatToMatchesGetString<int8_t>();
+    expectFormatToMatchesGetString<int16_t>();
+    expectFormatToMatchesGetString<uint32_t>();
+    expectFormatToMatchesGetString<int64_t>();
+    expectFormatToMatchesGetString<uint64_t>();
+}
+
+TEST_F(BitsView, WillRenderEachValueLazily) {
+    std::vector<uint8_t> const values {0, 1, 0xAB};
+    auto stringFormat = bb::DEFAULT_STRING_FORMAT;
+    stringFormat.format = bb::Format::Hexadecimal;
+    stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+    std::vector<std::string> rendered;
+    for (std::string_view const bits : values | bb::views::as_bits(stringFormat)) {
+        rendered.emplace_back(bits);
+    }
+    ASSERT_EQ((std::vector<std::string>{"0x00", "0x01", "0xAB"}), rendered);
+    ASSERT_EQ(3, (values | bb::views::as_bits()).size());
+}
+
+TEST_F(BitsView, WillUseGlobalStringFormatByDefault) {
+    std::array<int16_t, 2> constexpr values {-1, 2};
+    bb::BitsBase::stringFormat.bitUnit = bb::BitUnit::Byte;
+    auto const view = values | bb::views::as_bits();
+    auto itr = view.begin();
+    ASSERT_EQ("11111111 11111111", *itr);
+    ++itr;
+    ASSERT_EQ("10", *itr);
+    ASSERT_EQ(view.end(), ++itr);
+}
+
+TEST_F(BitsView, WillRenderChunksOfFixedSize) {
+    std::vector<uint8_t> const values {0x1, 0x2, 0x3, 0xFF};
+    auto stringFormat = bb::DEFAULT_STRING_FORMAT;
+    stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+    bb::ChunkedBitsRenderer<uint8_t> renderer{values, stringFormat, 5, ','};
+    std::string joined;
+    std::vector<size_t> chunkSizes;
+    for (auto chunk = renderer.next(); !chunk.empty(); chunk = renderer.next()) {
+        joined += chunk;
+        chunkSizes.push_back(chunk.size());
+    }
+    ASSERT_EQ("00000001,00000010,00000011,11111111,", joined);
+    ASSERT_EQ((std::vector<size_t>{5, 5, 5, 5, 5, 5, 5, 1}), chunkSizes);
+}
+
+TEST_F(BitsView, WillProduceNoChunksForEmptyInput) {
+    bb::ChunkedBitsRenderer<uint32_t> renderer{{}, bb::DEFAULT_STRING_FORMAT, 64};
+    ASSERT_TRUE(renderer.next().empty());
+}
@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+
+#include "FileViewer.h"
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+class FileViewer : public testing::Test {
+public:
+    void SetUp() override {
+        stringFormat = bb::DEFAULT_STRING_FORMAT;
+        stringFormat.format = bb::Format::Hexadecimal;
+        stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+        path = std::filesystem::temp_directory_path() /
+            std::format("bit_viewer_{}.bin", testing::UnitTest::GetInstance()->current_test_info()->name());
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    void writeFile(std::vector<uint8_t> const& contents) const {
+        std::ofstream file {path, std::ios::binary};
+        file.write(reinterpret_cast<char const*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+    }
+
+    static std::vector<uint8_t> makeSequence(size_t const size) {
+        std::vector<uint8_t> contents(size);
+        std::iota(contents.begin(), contents.end(), uint8_t{0});
+        return contents;
+    }
+
+protected:
+    bb::StringFormat stringFormat {bb::DEFAULT_STRING_FORMAT};
+    std::filesystem::path path;
+};
+
+TEST_F(FileViewer, WillRenderWindowAtByteOffset) {
+    writeFile(makeSequence(10));
+    bb::FileViewer viewer {path, stringFormat, 4};
+    ASSERT_EQ(10, viewer.getSize());
+    ASSERT_EQ("0x0000000000000000: 0x00 0x01 0x02 0x03\n"
+              "0x0000000000000004: 0x04 0x05 0x06 0x07", viewer.renderWindow(0, 2));
+    ASSERT_EQ("0x0000000000000004: 0x04 0x05 0x06 0x07\n"
+              "0x0000000000000008: 0x08 0x09", viewer.renderWindow(32, 5));
+}
+
+TEST_F(FileViewer, WillRenderWindowAtBitOffset) {
+    writeFile({0b1010'0101, 0b1111'0000, 0b0000'1111});
+    stringFormat.format = bb::Format::Binary;
+    bb::FileViewer viewer {path, stringFormat, 1};
+    ASSERT_EQ("0x0000000000000000+3: 00101111\n"
+              "0x0000000000000001+3: 10000000", viewer.renderWindow(3, 4));
+}
+
+TEST_F(FileViewer, WillRenderWindowsSpanningPages) {
+    auto const contents = makeSequence(200);
+    writeFile(contents);
+    bb::FileViewer paged {path, stringFormat, 3, 2, 4};
+    bb::FileViewer unpaged {path, stringFormat, 3, 100, 4};
+    for (uint64_t const bitOffset : {0U, 8U, 24U, 61U, 700U, 1500U, 1599U}) {
+        for (size_t const numLines : {1U, 2U, 5U, 70U}) {
+            ASSERT_EQ(unpaged.renderWindow(bitOffset, numLines), paged.renderWindow(bitOffset, numLines))
+                << "Bit offset " << bitOffset << ", lines " << numLines;
+        }
+    }
+}
+
+TEST_F(FileViewer, WillKeepCacheBounded) {
+    writeFile(makeSequence(255));
+    bb::FileViewer viewer {path, stringFormat, 1, 4, 3};
+    auto const window = viewer.renderWindow(0, 8);
+    for (uint64_t line = 0; line < 255; line += 5) {
+        auto const ignored [[maybe_unused]] = viewer.renderWindow(line * 8, 6);
+        ASSERT_LE(viewer.getNumCachedPages(), 3);
+    }
+    ASSERT_EQ(window, viewer.renderWindow(0, 8));
+}
+
+TEST_F(FileViewer, WillRejectOffsetsOutsideFile) {
+    writeFile(makeSequence(2));
+    bb::FileViewer viewer {path, stringFormat};
+    ASSERT_THROW(auto ret [[maybe_unused]] = viewer.renderWindow(16, 1), bb::OutOfRangeException);
+    ASSERT_EQ("", viewer.renderWindow(9, 1)); // Fewer than 8 bits remain
+    ASSERT_EQ("", viewer.renderWindow(0, 0));
+}
+
+TEST_F(FileViewer, WillClampWindowToEndOfFile) {
+    writeFile(makeSequence(8));
+    bb::FileViewer viewer {path, stringFormat, 2, 2};
+    ASSERT_EQ("0x0000000000000004: 0x04 0x05\n"
+              "0x0000000000000006: 0x06 0x07", viewer.renderWindow(32, std::numeric_limits<size_t>::max()));
+    ASSERT_EQ("0x0000000000000006: 0x06 0x07", viewer.renderWindow(48, 3));
+    // The file ends on a page boundary, so no page past the end is rendered
+    ASSERT_EQ(1, viewer.getNumCachedPages());
+    ASSERT_EQ("0x0000000000000006+1: 0x0C", viewer.renderWindow(49, std::numeric_limits<size_t>::max()));
+    ASSERT_EQ("", viewer.renderWindow(57, std::numeric_limits<size_t>::max()));
+}
+
+TEST_F(FileViewer, WillReleaseFileDescriptorOnceMapped) {
+    writeFile(makeSequence(16));
+    auto const countOpenFiles = [] {
+        auto const entries = std::filesystem::directory_iterator{"/proc/self/fd"};
+        return std::distance(std::filesystem::begin(entries), std::filesystem::end(entries));
+    };
+    auto const openFiles = countOpenFiles();
+    bb::FileViewer viewer {path, stringFormat};
+    ASSERT_EQ(openFiles, countOpenFiles());
+    ASSERT_EQ("0x0000000000000000: 0x00 0x01", viewer.renderWindow(0, 1).substr(0, 29));
+}
+
+TEST_F(FileViewer, WillReportMissingFile) {
+    ASSERT_THROW(bb::FileViewer{path / "missing"}, std::system_error);
+}
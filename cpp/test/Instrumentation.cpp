@@ -0,0 +1,99 @@
+// Instrumentation is compiled out unless enabled, so this test enables it for its own translation unit
+#define BITS_AND_BYTES_INSTRUMENTATION
+#include "gtest/gtest.h"
+
+#include "Bits.h"
+
+#include <string>
+#include <thread>
+
+namespace bb = bits_and_bytes;
+namespace instrumentation = bits_and_bytes::instrumentation;
+
+class Instrumentation : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+        instrumentation::reset();
+    }
+
+    static size_t index(auto const enumerator) {
+        return static_cast<size_t>(enumerator);
+    }
+};
+
+TEST_F(Instrumentation, WillCountParsesByFormat) {
+    auto const binary [[maybe_unused]] = bb::Bits<uint8_t>{"1010"};
+    auto const hex [[maybe_unused]] = bb::Bits<uint16_t>{"0xAF"};
+    auto const anotherHex [[maybe_unused]] = bb::Bits<int32_t>{"0x1"};
+    auto const counters = instrumentation::snapshot();
+    ASSERT_EQ(1, counters.parses[index(bb::Format::Binary)]);
+    ASSERT_EQ(2, counters.parses[index(bb::Format::Hexadecimal)]);
+}
+
+TEST_F(Instrumentation, WillCountRendersAndBytesProduced) {
+    bb::BitsBase::stringFormat.bitUnit = bb::BitUnit::Nibble;
+    auto const output = std::string{bb::Bits{uint8_t{0xFF}}.getString()};
+    bb::BitsBase::stringFormat.format = bb::Format::Hexadecimal;
+    bb::BitsBase::stringFormat.bitUnit = bb::BitUnit::Byte;
+    std::string rendered;
+    bb::BitsPresenter{bb::BitsBase::stringFormat, 16}.formatTo(rendered, bb::Bits{uint16_t{0xABC}});
+    auto const counters = instrumentation::snapshot();
+    ASSERT_EQ(1, counters.renders[index(bb::Format::Binary)][index(bb::BitUnit::Nibble)]);
+    ASSERT_EQ(1, counters.renders[index(bb::Format::Hexadecimal)][index(bb::BitUnit::Byte)]);
+    ASSERT_EQ(0, counters.renders[index(bb::Format::Binary)][index(bb::BitUnit::None)]);
+    ASSERT_EQ(output.size() + rendered.size(), counters.bytesProduced);
+}
+
+TEST_F(Instrumentation, WillCountPresenterCacheLookups) {
+    bb::Bits const bits {int64_t{-1}};
+    for (int i = 0; i < 3; ++i) {
+        auto const output [[maybe_unused]] = bits.getString();
+    }
+    auto const counters = instrumentation::snapshot();
+    ASSERT_EQ(1, counters.presenterCacheMisses);
+    ASSERT_EQ(2, counters.presenterCacheHits);
+}
+
+TEST_F(Instrumentation, WillCountAllocationsThroughCountingResource) {
+    instrumentation::CountingMemoryResource resource;
+    auto const smallValue [[maybe_unused]] = bb::Bits<uint8_t>{"1", &resource};
+    ASSERT_EQ(0, instrumentation::snapshot().allocations); // Fits in the small string buffer
+    auto const largeValue [[maybe_unused]] = bb::Bits<uint64_t>{"1", &resource};
+    auto const afterParse = instrumentation::snapshot();
+    ASSERT_GT(afterParse.allocations, 0);
+    ASSERT_GE(afterParse.bytesAllocated, 64);
+    auto const output = bb::Bits<uint64_t>{uint64_t{1} << 40U}.getString(&resource);
+    ASSERT_EQ(output.get_allocator().resource(), &resource);
+    ASSERT_GT(instrumentation::snapshot().allocations, afterParse.allocations);
+}
+
+TEST_F(Instrumentation, WillNotCountAllocationsOutsideCountingResource) {
+    auto const value [[maybe_unused]] = bb::Bits<uint64_t>{"1"};
+    auto const output [[maybe_unused]] = std::string{value.getString()};
+    ASSERT_EQ(0, instrumentation::snapshot().allocations);
+}
+
+TEST_F(Instrumentation, WillCountExceptions) {
+    for (auto const* invalid : {"0xZZ", "2", "1 0000 0000"}) {
+        try {
+            auto const bits [[maybe_unused]] = bb::Bits<int8_t>{invalid};
+        } catch (std::runtime_error const&) {
+        }
+    }
+    ASSERT_EQ(3, instrumentation::snapshot().exceptions);
+}
+
+TEST_F(Instrumentation, WillAggregateCountersAcrossThreads) {
+    auto const parse = [] {
+        for (int i = 0; i < 10; ++i) {
+            auto const bits [[maybe_unused]] = bb::Bits<uint8_t>{"0x1"};
+        }
+    };
+    std::thread worker {parse};
+    worker.join();
+    parse();
+    ASSERT_EQ(20, instrumentation::snapshot().parses[index(bb::Format::Hexadecimal)]);
+    instrumentation::reset();
+    ASSERT_EQ(0, instrumentation::snapshot().parses[index(bb::Format::Hexadecimal)]);
+}
@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+
+#include "Bits.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+namespace {
+    std::atomic<size_t> globalAllocationCount {};
+
+    /// Memory resource that counts the allocations it forwards to its upstream resource
+    class CountingResource final : public std::pmr::memory_resource {
+    public:
+        explicit CountingResource(std::pmr::memory_resource* upstream) : upstream(upstream) {}
+        size_t allocationCount {};
+
+    private:
+        void* do_allocate(size_t const bytes, size_t const alignment) override {
+            ++allocationCount;
+            return upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t const bytes, size_t const alignment) override {
+            upstream->deallocate(pointer, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(memory_resource const& another) const noexcept override {
+            return this == &another;
+        }
+
+        std::pmr::memory_resource* upstream;
+    };
+}
+
+// Replacements for the global allocation functions that count calls to the global allocator
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete" // GCC pairs the replaced new/delete with malloc/free
+#endif
+void* operator new(size_t const size) {
+    ++globalAllocationCount;
+    if (void* pointer = std::malloc(size ? size : 1)) return pointer;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+class MemoryResource : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+        bb::BitsBase::stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+        bb::BitsBase::stringFormat.bitUnit = bb::BitUnit::Nibble;
+    }
+
+protected:
+    std::array<std::byte, 1U << 16U> arenaBuffer {};
+};
+
+TEST_F(MemoryResource, WillParseAndRenderWithoutGlobalAllocations) {
+    std::pmr::monotonic_buffer_resource arena {arenaBuffer.data(), arenaBuffer.size(), std::pmr::null_memory_resource()};
+    CountingResource countingResource {&arena};
+    std::pmr::vector<std::pmr::string> rendered {&countingResource};
+    rendered.reserve(8);
+    std::array<int64_t, 4> values {};
+
+    auto const globalAllocationsBefore = globalAllocationCount.load();
+    values[0] = bb::Bits<int8_t>{"1111 1000", &countingResource}.getValue();
+    values[1] = bb::Bits<uint16_t>{"0xAF", &countingResource}.getValue();
+    values[2] = bb::Bits<int32_t>{"0x FFFF FFFF", &countingResource}.getValue();
+    values[3] = bb::Bits<int64_t>{"0101", &countingResource}.getValue();
+    rendered.push_back(bb::Bits<int8_t>{-8}.getString(&countingResource));
+    rendered.push_back(bb::Bits<uint64_t>{0xFFFF'0000'FFFF'0000}.getString(&countingResource));
+    rendered.push_back(bb::convertBinaryToHexString("1010 1111", &countingResource));
+    rendered.push_back(bb::zeroExtend<uint32_t>("0xA", &countingResource));
+    auto const globalAllocations = globalAllocationCount.load() - globalAllocationsBefore;
+
+    ASSERT_EQ(0, globalAllocations);
+    ASSERT_GT(countingResource.allocationCount, 0);
+    ASSERT_EQ((std::array<int64_t, 4>{-8, 0xAF, -1, 5}), values);
+    ASSERT_EQ("1111 1000", rendered[0]);
+    ASSERT_EQ("1111 1111 1111 1111 0000 0000 0000 0000 1111 1111 1111 1111 0000 0000 0000 0000", rendered[1]);
+    ASSERT_EQ("0xAF", rendered[2]);
+    ASSERT_EQ("00000000000000000000000000001010", rendered[3]);
+}
+
+TEST_F(MemoryResource, WillProduceSameResultsAsDefaultAllocator) {
+    std::pmr::monotonic_buffer_resource arena {arenaBuffer.data(), arenaBuffer.size()};
+    auto const expectEqual = [](std::string_view const expected, std::string_view const actual) {
+        ASSERT_EQ(expected, actual);
+    };
+    expectEqual(bb::normalize("  1  0 0 "), bb::normalize("  1  0 0 ", &arena));
+    expectEqual(bb::canonicalize("0x  AF  AF ", true), bb::canonicalize("0x  AF  AF ", true, &arena));
+    expectEqual(bb::validateHex("0xAF AF"), bb::validateHex("0xAF AF", &arena));
+    expectEqual(bb::canonicalizeBinaryString("1010 1111"), bb::canonicalizeBinaryString("1010 1111", &arena));
+    expectEqual(bb::convertHexToCanonicalBinaryString("0xFA"), bb::convertHexToCanonicalBinaryString("0xFA", &arena));
+    expectEqual(bb::Bits<int16_t>{-2}.getString(), bb::Bits<int16_t>{-2}.getString(&arena));
+}
+
+TEST_F(MemoryResource, WillReportInvalidInputWhenParsingWithMemoryResource) {
+    std::pmr::monotonic_buffer_resource arena {arenaBuffer.data(), arenaBuffer.size()};
+    ASSERT_THROW(
+        try {
+            auto ret [[maybe_unused]] = bb::Bits<int8_t>("0xA3 YZ", &arena);
+        } catch (bb::BitFormatException const& ex) {
+            ASSERT_STREQ("0xA3 YZ is not a valid hexadecimal value.", ex.what());
+            throw;
+        }, bb::BitFormatException);
+    ASSERT_THROW(
+        try {
+            auto ret [[maybe_unused]] = bb::Bits<int8_t>("0 1111 1111", &arena);
+        } catch (bb::OutOfRangeException const& ex) {
+            ASSERT_STREQ("Binary value 011111111 (Decimal = 255) exceeds type's maximum 127", ex.what());
+            throw;
+        }, bb::OutOfRangeException);
+}
@@ -0,0 +1,41 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <format>
+#include <string>
+
+import bits_and_bytes;
+
+namespace bb = bits_and_bytes;
+
+class Module : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+    }
+};
+
+TEST_F(Module, WillParseAndRenderBits) {
+    bb::Bits<uint8_t> const bits {"0xA5"};
+    ASSERT_EQ(0xA5, bits.getValue());
+    ASSERT_EQ("10100101", bits.getString());
+    bb::BitsBase::stringFormat.format = bb::Format::Hexadecimal;
+    ASSERT_EQ("0xA5", bb::Bits<uint8_t>{"10100101"}.getString());
+}
+
+TEST_F(Module, WillRenderWithStringFormat) {
+    bb::StringFormat stringFormat {bb::DEFAULT_STRING_FORMAT};
+    stringFormat.format = bb::Format::Octal;
+    std::string output;
+    bb::BitsPresenter{stringFormat, 8}.formatTo(output, bb::Bits{uint8_t{0755 & 0xFF}});
+    ASSERT_EQ("0o355", output);
+}
+
+TEST_F(Module, WillFormatBits) {
+    ASSERT_EQ("101", std::format("{}", bb::Bits{uint8_t{5}}));
+}
+
+TEST_F(Module, WillThrowExportedExceptions) {
+    ASSERT_THROW(bb::Bits<uint8_t>{"0x1FF"}, bb::OutOfRangeException);
+    ASSERT_THROW(bb::Bits<uint8_t>{"0xZZ"}, bb::BitFormatException);
+}
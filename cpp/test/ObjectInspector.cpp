@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+
+#include "ObjectInspector.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+namespace {
+    struct Message {
+        uint8_t kind;
+        uint32_t id;
+        uint16_t flags;
+    };
+    static_assert(sizeof(Message) == 12);
+
+    struct Packed {
+        uint32_t id;
+        uint16_t low;
+        uint16_t high;
+    };
+}
+
+class ObjectInspector : public testing::Test {
+public:
+    void SetUp() override {
+        stringFormat = bb::DEFAULT_STRING_FORMAT;
+        stringFormat.format = bb::Format::Hexadecimal;
+        stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+    }
+
+    /// Sets the members of a message and fills its padding with the given byte, as if the message had been built in
+    /// uninitialized memory. Copying a message need not preserve its padding, so the message is filled in place
+    static void fillMessage(Message& message, uint8_t const kind, uint32_t const id, uint16_t const flags,
+                            uint8_t const padding) {
+        std::memset(&message, padding, sizeof(Message));
+        message.kind = kind;
+        message.id = id;
+        message.flags = flags;
+    }
+
+protected:
+    bb::StringFormat stringFormat {bb::DEFAULT_STRING_FORMAT};
+};
+
+TEST_F(ObjectInspector, WillDetectPaddingFromMembers) {
+    auto const layout = bb::ObjectLayout<Message>::fromMembers(&Message::kind, &Message::id, &Message::flags);
+    ASSERT_EQ(5, layout.getNumPaddingBytes());
+    ASSERT_FALSE(layout.isPadding(0));
+    for (size_t i = 1; i < 4; ++i) {
+        ASSERT_TRUE(layout.isPadding(i));
+    }
+    ASSERT_FALSE(layout.isPadding(4));
+    ASSERT_FALSE(layout.isPadding(9));
+    ASSERT_TRUE(layout.isPadding(10));
+    ASSERT_TRUE(layout.isPadding(11));
+}
+
+TEST_F(ObjectInspector, WillDetectPaddingFromAssignment) {
+    auto const layout = bb::ObjectLayout<Message>::fromAssignment([](Message& message) {
+        message.kind = 1;
+        message.id = 2;
+        message.flags = 3;
+    });
+    auto const expected = bb::ObjectLayout<Message>::fromMembers(&Message::kind, &Message::id, &Message::flags);
+    for (size_t i = 0; i < sizeof(Message); ++i) {
+        ASSERT_EQ(expected.isPadding(i), layout.isPadding(i));
+    }
+    ASSERT_EQ(0, bb::ObjectLayout<Packed>::withoutPadding().getNumPaddingBytes());
+}
+
+TEST_F(ObjectInspector, WillRenderObjectRepresentationWithPaddingMarked) {
+    bb::ObjectInspector<Message> const inspector {
+        bb::ObjectLayout<Message>::fromMembers(&Message::kind, &Message::id, &Message::flags), stringFormat};
+    std::vector<Message> messages(2);
+    fillMessage(messages[0], 0x01, 0x0000'002A, 0xBEEF, 0x7F);
+    fillMessage(messages[1], 0x02, 0, 0, 0);
+    if constexpr (std::endian::native == std::endian::little) {
+        ASSERT_EQ("0x01 [0x7F] [0x7F] [0x7F] 0x2A 0x00 0x00 0x00 0xEF 0xBE [0x7F] [0x7F]",
+                  inspector.render(messages[0]));
+    }
+    auto const rendered = inspector.render(messages);
+    ASSERT_EQ(1, std::ranges::count(rendered, '\n'));
+    ASSERT_TRUE(rendered.ends_with("0x02 [0x00] [0x00] [0x00] 0x00 0x00 0x00 0x00 0x00 0x00 [0x00] [0x00]"));
+}
+
+TEST_F(ObjectInspector, WillFindObjectsWithNonZeroPadding) {
+    bb::ObjectInspector<Message> const inspector {
+        bb::ObjectLayout<Message>::fromMembers(&Message::kind, &Message::id, &Message::flags), stringFormat};
+    std::vector<Message> messages(1000);
+    for (auto& message : messages) {
+        // Members with every bit set must not be mistaken for padding
+        fillMessage(message, 0xFF, 0xFFFF'FFFF, 0xFFFF, 0);
+    }
+    auto* bytes = reinterpret_cast<uint8_t*>(messages.data());
+    bytes[7 * sizeof(Message) + 2] = 1;
+    bytes[500 * sizeof(Message) + 11] = 0x80;
+    bytes[999 * sizeof(Message) + 10] = 0x10;
+    ASSERT_EQ((std::vector<size_t>{7, 500, 999}), inspector.findNonZeroPadding(messages));
+    ASSERT_TRUE(inspector.hasNonZeroPadding(messages[7]));
+    ASSERT_FALSE(inspector.hasNonZeroPadding(messages[8]));
+
+    std::vector<Packed> const packed(10, Packed{0xFFFF'FFFF, 1, 2});
+    bb::ObjectInspector<Packed> const packedInspector {bb::ObjectLayout<Packed>::withoutPadding()};
+    ASSERT_TRUE(packedInspector.findNonZeroPadding(packed).empty());
+}
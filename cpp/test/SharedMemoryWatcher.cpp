@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+
+#include "SharedMemoryWatcher.h"
+
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+class SharedMemoryWatcher : public testing::Test {
+public:
+    void SetUp() override {
+        stringFormat = bb::DEFAULT_STRING_FORMAT;
+        stringFormat.format = bb::Format::Hexadecimal;
+        stringFormat.leadingZeroes = bb::LeadingZeroes::Include;
+    }
+
+protected:
+    bb::StringFormat stringFormat {bb::DEFAULT_STRING_FORMAT};
+};
+
+TEST_F(SharedMemoryWatcher, WillRenderEveryWordOnFirstUpdate) {
+    std::vector<uint16_t> region(5);
+    std::iota(region.begin(), region.end(), uint16_t{1});
+    bb::DirtyWordTracker<uint16_t> tracker {region.size() * sizeof(uint16_t), stringFormat};
+    auto const dirty = tracker.update(std::as_bytes(std::span{region}));
+    ASSERT_EQ((std::vector<size_t>{0, 1, 2, 3, 4}), std::vector<size_t>(dirty.begin(), dirty.end()));
+    ASSERT_EQ("0x0003", tracker.getText(2));
+    ASSERT_EQ(5, tracker.getWord(4));
+}
+
+TEST_F(SharedMemoryWatcher, WillReRenderOnlyChangedWords) {
+    std::vector<uint32_t> region(1000, 0xFFFF'FFFF);
+    bb::DirtyWordTracker<uint32_t> tracker {region.size() * sizeof(uint32_t), stringFormat};
+    auto const ignored [[maybe_unused]] = tracker.update(std::as_bytes(std::span{region}));
+    ASSERT_TRUE(tracker.update(std::as_bytes(std::span{region})).empty());
+
+    region[3] = 0xA;
+    region[17] = 0xB;
+    region[999] = 0xC;
+    auto const dirty = tracker.update(std::as_bytes(std::span{region}));
+    ASSERT_EQ((std::vector<size_t>{3, 17, 999}), std::vector<size_t>(dirty.begin(), dirty.end()));
+    ASSERT_EQ("0x0000000A", tracker.getText(3));
+    ASSERT_EQ("0xFFFFFFFF", tracker.getText(4));
+    ASSERT_EQ("0x0000000C", tracker.getText(999));
+
+    std::string updates;
+    tracker.appendUpdates(updates);
+    ASSERT_EQ("3 0x0000000A\n17 0x0000000B\n999 0x0000000C\n", updates);
+}
+
+TEST_F(SharedMemoryWatcher, WillReuseSlotsForTextOfDifferentLengths) {
+    stringFormat.format = bb::Format::Binary;
+    stringFormat.leadingZeroes = bb::LeadingZeroes::Suppress;
+    stringFormat.bitUnit = bb::BitUnit::Nibble;
+    std::vector<int8_t> region {-1, 1};
+    bb::DirtyWordTracker<int8_t> tracker {region.size(), stringFormat};
+    auto ignored [[maybe_unused]] = tracker.update(std::as_bytes(std::span{region}));
+    ASSERT_EQ("1111 1111", tracker.getText(0));
+    region = {2, -2};
+    ignored = tracker.update(std::as_bytes(std::span{region}));
+    ASSERT_EQ("10", tracker.getText(0));
+    ASSERT_EQ("1111 1110", tracker.getText(1));
+}
+
+TEST_F(SharedMemoryWatcher, WillIgnoreTrailingPartialWord) {
+    std::vector<uint8_t> region(11, 0);
+    bb::DirtyWordTracker<uint32_t> tracker {region.size(), stringFormat};
+    ASSERT_EQ(2, tracker.getNumWords());
+    ASSERT_EQ(2, tracker.update(std::as_bytes(std::span{region})).size());
+}
+
+TEST_F(SharedMemoryWatcher, WillWatchSharedMemoryObject) {
+    auto const name = std::format("/bit_viewer_test_{}", ::getpid());
+    int const fileDescriptor = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+    ASSERT_GE(fileDescriptor, 0);
+    size_t constexpr SIZE {4096};
+    ASSERT_EQ(0, ::ftruncate(fileDescriptor, SIZE));
+    void* mapping = ::mmap(nullptr, SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    ASSERT_NE(MAP_FAILED, mapping);
+    auto* words = static_cast<uint64_t*>(mapping);
+    {
+        bb::SharedMemoryWatcher<uint64_t> watcher {name, stringFormat};
+        ASSERT_EQ(SIZE / sizeof(uint64_t), watcher.poll().size());
+        words[100] = 0xDEAD'BEEF;
+        auto const dirty = watcher.poll();
+        ASSERT_EQ(1, dirty.size());
+        ASSERT_EQ(100, dirty[0]);
+        ASSERT_EQ("0x00000000DEADBEEF", watcher.getTracker().getText(100));
+    }
+    ::munmap(mapping, SIZE);
+    ::close(fileDescriptor);
+    ::shm_unlink(name.c_str());
+    ASSERT_THROW(bb::SharedMemoryWatcher<uint64_t>{name}, std::system_error);
+}
@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+
+#include "BitsView.h"
+#include "Transforms.h"
+
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+class Transforms : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+    }
+
+    /// Reference bit reversal that moves one bit at a time
+    template<typename NumericType>
+    static NumericType reverseBitByBit(NumericType const value) {
+        using UnsignedNumericType = std::make_unsigned_t<NumericType>;
+        auto const bits = static_cast<UnsignedNumericType>(value);
+        UnsignedNumericType reversed{};
+        size_t constexpr numBits = sizeof(NumericType) * bb::NUM_BITS_IN_ONE_BYTE;
+        for (size_t bit = 0; bit < numBits; ++bit) {
+            if ((bits >> bit) & 1U) {
+                reversed |= static_cast<UnsignedNumericType>(UnsignedNumericType{1} << (numBits - 1U - bit));
+            }
+        }
+        return static_cast<NumericType>(reversed);
+    }
+
+    template<typename NumericType>
+    static std::vector<NumericType> randomValues(size_t const count) {
+        std::mt19937_64 generator {42};
+        std::vector<NumericType> values(count);
+        for (auto& value : values) {
+            value = static_cast<NumericType>(generator());
+        }
+        return values;
+    }
+
+    template<typename NumericType>
+    static void expectSpanTransformsMatchScalar() {
+        // An odd count exercises the scalar tail after the vectorized blocks
+        auto const values = randomValues<NumericType>(101);
+        std::vector<NumericType> output(values.size());
+        bb::reverseBits(std::span{values}, std::span{output});
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(reverseBitByBit(values[i]), output[i]);
+        }
+        bb::byteSwap(std::span{values}, std::span{output});
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(std::byteswap(values[i]), output[i]);
+        }
+        auto inPlace = values;
+        bb::grayEncode(std::span{inPlace});
+        bb::grayDecode(std::span{inPlace});
+        ASSERT_EQ(values, inPlace);
+        bb::reverseBits(std::span{inPlace});
+        bb::reverseBits(std::span{inPlace});
+        ASSERT_EQ(values, inPlace);
+    }
+};
+
+TEST_F(Transforms, WillReverseBits) {
+    static_assert(bb::reverseBits(uint8_t{0b0000'0001}) == 0b1000'0000);
+    ASSERT_EQ(0x8000, bb::reverseBits(uint16_t{1}));
+    ASSERT_EQ(0x0F00'0000U, bb::reverseBits(uint32_t{0xF0}));
+    ASSERT_EQ(int8_t{-128}, bb::reverseBits(int8_t{1}));
+    ASSERT_EQ(0x1ULL, bb::reverseBits(0x8000'0000'0000'0000ULL));
+}
+
+TEST_F(Transforms, WillSwapBytes) {
+    static_assert(bb::byteSwap(uint16_t{0x1234}) == 0x3412);
+    ASSERT_EQ(0x7856'3412U, bb::byteSwap(uint32_t{0x1234'5678}));
+    ASSERT_EQ(0xAB, bb::byteSwap(uint8_t{0xAB}));
+}
+
+TEST_F(Transforms, WillConvertToAndFromGrayCode) {
+    std::vector<uint8_t> const expected {0b000, 0b001, 0b011, 0b010, 0b110, 0b111, 0b101, 0b100};
+    for (uint8_t value = 0; value < expected.size(); ++value) {
+        ASSERT_EQ(expected[value], bb::grayEncode(value));
+        ASSERT_EQ(value, bb::grayDecode(expected[value]));
+    }
+    for (auto const value : randomValues<int64_t>(100)) {
+        ASSERT_EQ(value, bb::grayDecode(bb::grayEncode(value)));
+        // Adjacent values differ in exactly one bit of their Gray codes
+        ASSERT_EQ(1, std::popcount(static_cast<uint64_t>(bb::grayEncode(value) ^ bb::grayEncode(value + 1))));
+    }
+}
+
+TEST_F(Transforms, WillTransformSpansLikeScalars) {
+    expectSpanTransformsMatchScalar<uint8_t>();
+    expectSpanTransformsMatchScalar<int16_t>();
+    expectSpanTransformsMatchScalar<uint32_t>();
+    expectSpanTransformsMatchScalar<int64_t>();
+}
+
+TEST_F(Transforms, WillThrowWhenOutputIsTooSmall) {
+    std::vector<uint16_t> const values(4);
+    std::vector<uint16_t> output(3);
+    ASSERT_THROW(bb::byteSwap(std::span{values}, std::span{output}), bb::OutOfRangeException);
+}
+
+TEST_F(Transforms, WillApplyTransformWhileRendering) {
+    std::vector<uint16_t> const values {0x0001, 0x00FF};
+    auto stringFormat = bb::DEFAULT_STRING_FORMAT;
+    stringFormat.format = bb::Format::Hexadecimal;
+    std::vector<std::string> rendered;
+    for (std::string_view const bits : values | bb::views::as_bits(stringFormat, bb::Transform::ByteSwap)) {
+        rendered.emplace_back(bits);
+    }
+    ASSERT_EQ((std::vector<std::string>{"0x100", "0xFF00"}), rendered);
+    ASSERT_EQ((std::vector<uint16_t>{0x0001, 0x00FF}), values);
+
+    bb::ChunkedBitsRenderer<uint16_t> renderer {values, stringFormat, 64, ' ', bb::Transform::BitReverse};
+    ASSERT_EQ("0x8000 0xFF00 ", renderer.next());
+}
+
+TEST_F(Transforms, WillParseTransformedTextBackToOriginalValues) {
+    auto const values = randomValues<int32_t>(50);
+    for (auto const transform : {bb::Transform::None, bb::Transform::ByteSwap, bb::Transform::BitReverse,
+                                 bb::Transform::GrayEncode, bb::Transform::GrayDecode}) {
+        auto itr = values.begin();
+        for (std::string_view const bits : values | bb::views::as_bits(bb::BitsBase::stringFormat, transform)) {
+            ASSERT_EQ(*itr++, bb::parseTransformed<int32_t>(bits, transform));
+        }
+    }
+}
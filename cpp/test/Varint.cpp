@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+
+#include "Varint.h"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace bb = bits_and_bytes;
+
+class Varint : public testing::Test {
+public:
+    void SetUp() override {
+        bb::BitsBase::stringFormat = bb::DEFAULT_STRING_FORMAT;
+    }
+
+    static std::vector<std::byte> toBytes(std::initializer_list<uint8_t> const values) {
+        std::vector<std::byte> bytes;
+        for (auto const value : values) {
+            bytes.push_back(static_cast<std::byte>(value));
+        }
+        return bytes;
+    }
+
+    /// Reference decoder that reads one byte at a time
+    static std::vector<uint64_t> decodeBytewise(std::span<std::byte const> const input) {
+        std::vector<uint64_t> values;
+        uint64_t value{};
+        size_t shift{};
+        for (auto const byte : input) {
+            value |= static_cast<uint64_t>(std::to_integer<uint8_t>(byte) & 0x7FU) << shift;
+            shift += 7;
+            if (!(std::to_integer<uint8_t>(byte) & 0x80U)) {
+                values.push_back(value);
+                value = 0;
+                shift = 0;
+            }
+        }
+        return values;
+    }
+};
+
+TEST_F(Varint, WillZigzagEncodeAndDecode) {
+    static_assert(bb::zigzagEncode(int32_t{0}) == 0U);
+    static_assert(bb::zigzagEncode(int32_t{-1}) == 1U);
+    static_assert(bb::zigzagEncode(int32_t{1}) == 2U);
+    static_assert(bb::zigzagEncode(int32_t{-2}) == 3U);
+    ASSERT_EQ(0xFFFF'FFFEU, bb::zigzagEncode(std::numeric_limits<int32_t>::max()));
+    ASSERT_EQ(0xFFFF'FFFFU, bb::zigzagEncode(std::numeric_limits<int32_t>::min()));
+    ASSERT_EQ(0xFF, bb::zigzagEncode(int8_t{-128}));
+    for (int16_t const value : {int16_t{0}, int16_t{-1}, int16_t{300}, int16_t{-32768}, int16_t{32767}}) {
+        ASSERT_EQ(value, bb::zigzagDecode(bb::zigzagEncode(value)));
+    }
+}
+
+TEST_F(Varint, WillEncodeProtobufVarints) {
+    std::vector<std::byte> output;
+    bb::appendVarint(output, 300U);
+    ASSERT_EQ(toBytes({0xAC, 0x02}), output);
+    output.clear();
+    bb::appendVarint(output, int32_t{-1});
+    ASSERT_EQ(toBytes({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01}), output);
+    output.clear();
+    bb::appendVarint(output, int32_t{-1}, bb::VarintEncoding::ZigZag);
+    ASSERT_EQ(toBytes({0x01}), output);
+    ASSERT_EQ(1, bb::getVarintLength(0));
+    ASSERT_EQ(2, bb::getVarintLength(300));
+    ASSERT_EQ(bb::MAX_VARINT_LENGTH, bb::getVarintLength(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST_F(Varint, WillDecodeVarintsOfEveryLength) {
+    std::vector<uint64_t> values {0, 1, 127, 128, 300, 16383, 16384};
+    for (size_t bits = 14; bits <= 64; bits += 7) {
+        values.push_back(bits >= 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << bits) - 1U);
+        values.push_back(uint64_t{1} << (std::min<size_t>(bits, 64) - 1U));
+    }
+    values.push_back(std::numeric_limits<uint64_t>::max());
+    std::vector<std::byte> encoded;
+    for (auto const value : values) {
+        bb::appendVarint(encoded, value);
+    }
+    std::vector<uint64_t> decoded;
+    bb::decodeVarints(std::span<std::byte const>{encoded}, decoded);
+    ASSERT_EQ(values, decoded);
+    ASSERT_EQ(values.size(), bb::countVarints(encoded));
+}
+
+TEST_F(Varint, WillMatchBytewiseDecoder) {
+    std::mt19937_64 generator {7};
+    std::vector<std::byte> encoded;
+    for (size_t i = 0; i < 10000; ++i) {
+        // Vary the width so that every varint length occurs
+        auto const value = generator();
+        bb::appendVarint(encoded, value >> (generator() % 64));
+    }
+    std::vector<uint64_t> decoded;
+    bb::decodeVarints(std::span<std::byte const>{encoded}, decoded);
+    ASSERT_EQ(decodeBytewise(encoded), decoded);
+}
+
+TEST_F(Varint, WillDecodeIntoBits) {
+    std::vector<std::byte> encoded;
+    for (int16_t const value : {int16_t{-2}, int16_t{5}, int16_t{-32768}}) {
+        bb::appendVarint(encoded, value, bb::VarintEncoding::ZigZag);
+    }
+    auto const bits = bb::decodeVarints<int16_t>(encoded, bb::VarintEncoding::ZigZag);
+    ASSERT_EQ(3, bits.size());
+    ASSERT_EQ(-2, bits[0]);
+    ASSERT_EQ("101", bits[1].getString());
+    ASSERT_EQ(-32768, bits[2]);
+
+    encoded.clear();
+    bb::appendVarint(encoded, int8_t{-3});
+    ASSERT_EQ(-3, bb::decodeVarints<int8_t>(encoded)[0]);
+}
+
+TEST_F(Varint, WillThrowForMalformedVarints) {
+    auto const decode = [](std::initializer_list<uint8_t> const bytes) {
+        std::vector<uint64_t> values;
+        bb::decodeVarints(std::span<std::byte const>{toBytes(bytes)}, values);
+    };
+    ASSERT_THROW(decode({0x80}), bb::BitFormatException);
+    ASSERT_THROW(decode({0x01, 0xFF, 0xFF}), bb::BitFormatException);
+    ASSERT_THROW(decode({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}), bb::BitFormatException);
+    ASSERT_THROW(decode({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01}), bb::BitFormatException);
+    ASSERT_THROW(decode({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02}), bb::OutOfRangeException);
+    ASSERT_THROW(auto ignored = bb::decodeVarints<uint8_t>(toBytes({0xAC, 0x02})), bb::OutOfRangeException);
+    ASSERT_THROW(auto ignored = bb::decodeVarints<int8_t>(toBytes({0x80, 0x02}), bb::VarintEncoding::ZigZag),
+                 bb::OutOfRangeException);
+}
+
+TEST_F(Varint, WillRenderContinuationBitsAndPayloadGroups) {
+    std::vector<std::byte> encoded;
+    bb::appendVarint(encoded, 300U);
+    bb::appendVarint(encoded, 1U);
+    ASSERT_EQ("1|0101100 0|0000010 = 100101100\n0|0000001 = 1", bb::renderVarints<uint32_t>(encoded));
+
+    auto stringFormat = bb::DEFAULT_STRING_FORMAT;
+    stringFormat.format = bb::Format::Hexadecimal;
+    encoded.clear();
+    bb::appendVarint(encoded, int64_t{-2}, bb::VarintEncoding::ZigZag);
+    ASSERT_EQ("0|0000011 = 0xFFFFFFFFFFFFFFFE",
+              bb::renderVarints<int64_t>(encoded, stringFormat, bb::VarintEncoding::ZigZag));
+}